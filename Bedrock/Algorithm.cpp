@@ -2,6 +2,9 @@
 #include <Bedrock/Algorithm.h>
 #include <Bedrock/StringView.h>
 #include <Bedrock/Test.h>
+#include <Bedrock/Vector.h>
+#include <Bedrock/String.h>
+#include <Bedrock/Random.h>
 
 REGISTER_TEST("ReverseIterator")
 {
@@ -33,3 +36,214 @@ REGISTER_TEST("AnyOf")
 	TEST_TRUE(gAllOf(values, [](int v) { return v <= 5; }));
 	TEST_FALSE(gAllOf(values, [](int v) { return v < 3; }));
 };
+
+
+template <class taCompare = Details::SortLess>
+static bool sIsSorted(const auto& inContainer, taCompare inComp = {})
+{
+	for (int i = 1; i < inContainer.Size(); i++)
+		if (inComp(inContainer[i], inContainer[i - 1]))
+			return false;
+	return true;
+}
+
+
+REGISTER_TEST("Sort")
+{
+	// Sorting an empty or single-element range should do nothing.
+	Vector<int> empty;
+	gSort(empty);
+	TEST_TRUE(empty.Empty());
+
+	Vector<int> single = { 42 };
+	gSort(single);
+	TEST_TRUE(single[0] == 42);
+
+	// Random values (larger than the insertion sort threshold, forces the quicksort path).
+	constexpr int cSize = 10000;
+	Vector<int>	  values;
+	int			  rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		values.PushBack(rand_seed);
+	}
+
+	Vector<int> sorted = values;
+	gSort(sorted);
+	TEST_TRUE(sorted.Size() == values.Size());
+	TEST_TRUE(sIsSorted(sorted));
+
+	// Already sorted and reverse sorted inputs (the depth limit kicks in on bad pivot patterns).
+	gSort(sorted);
+	TEST_TRUE(sIsSorted(sorted));
+
+	Vector<int> reversed;
+	for (int i = cSize; i > 0; i--)
+		reversed.PushBack(i);
+	gSort(reversed);
+	TEST_TRUE(sIsSorted(reversed));
+
+	// All-equal input.
+	Vector<int> equal;
+	equal.Resize(cSize);
+	gSort(equal);
+	TEST_TRUE(sIsSorted(equal));
+
+	// Custom comparison.
+	auto greater = [](int inA, int inB) { return inA > inB; };
+	gSort(values, greater);
+	TEST_TRUE(sIsSorted(values, greater));
+};
+
+
+REGISTER_TEST("StableSort")
+{
+	struct Entry
+	{
+		int mKey;
+		int mOriginalIndex;
+	};
+
+	// Lots of duplicate keys to actually exercise stability.
+	constexpr int cSize = 5000;
+	Vector<Entry> entries;
+	int			  rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		entries.PushBack({ (rand_seed & 15), i });
+	}
+
+	gStableSort(entries, [](const Entry& inA, const Entry& inB) { return inA.mKey < inB.mKey; });
+
+	// Keys must be sorted, and equal keys must keep their original order.
+	for (int i = 1; i < entries.Size(); i++)
+	{
+		TEST_TRUE(entries[i - 1].mKey <= entries[i].mKey);
+		if (entries[i - 1].mKey == entries[i].mKey)
+			TEST_TRUE(entries[i - 1].mOriginalIndex < entries[i].mOriginalIndex);
+	}
+
+	// Strings exercise the move-construction path of the merge scratch buffer.
+	Vector<String> strings = { "pear", "apple", "orange", "kiwi", "banana", "apple", "fig" };
+	gStableSort(strings);
+	TEST_TRUE(sIsSorted(strings));
+};
+
+
+REGISTER_TEST("RadixSort")
+{
+	// Unsigned 64-bit keys.
+	constexpr int  cSize = 20000;
+	Vector<uint64> handles;
+	int			   rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		uint64 high = (uint32)rand_seed;
+		rand_seed = gRand32(rand_seed);
+		handles.PushBack((high << 32) | (uint32)rand_seed);
+	}
+
+	gRadixSort(handles);
+	TEST_TRUE(sIsSorted(handles));
+
+	// Signed keys, including negative values.
+	Vector<int> signed_values;
+	rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		signed_values.PushBack(rand_seed - cMaxInt / 2);
+	}
+
+	gRadixSort(signed_values);
+	TEST_TRUE(sIsSorted(signed_values));
+
+	// Key-payload pairs, sorted by key. Radix sort is stable so equal keys keep their order.
+	struct Pair
+	{
+		uint32 mKey;
+		int	   mIndex;
+	};
+
+	Vector<Pair> pairs;
+	rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		pairs.PushBack({ (uint32)(rand_seed & 255), i });
+	}
+
+	gRadixSort(pairs, [](const Pair& inPair) { return inPair.mKey; });
+
+	for (int i = 1; i < pairs.Size(); i++)
+	{
+		TEST_TRUE(pairs[i - 1].mKey <= pairs[i].mKey);
+		if (pairs[i - 1].mKey == pairs[i].mKey)
+			TEST_TRUE(pairs[i - 1].mIndex < pairs[i].mIndex);
+	}
+};
+
+
+REGISTER_TEST("RadixSort TempMemory")
+{
+	TEST_INIT_TEMP_MEMORY(100_KiB);
+
+	// The scratch buffer should come from (and go back to) the temp arena.
+	Vector<uint16> values;
+	int			   rand_seed = 42;
+	for (int i = 0; i < 10000; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		values.PushBack((uint16)rand_seed);
+	}
+
+	gRadixSort(values);
+	TEST_TRUE(sIsSorted(values));
+};
+
+
+REGISTER_TEST("Heap")
+{
+	// Empty and single-element ranges.
+	Vector<int> values;
+	gMakeHeap(values.Begin(), values.End());
+	values.PushBack(42);
+	gMakeHeap(values.Begin(), values.End());
+	gPopHeap(values.Begin(), values.End());
+	TEST_TRUE(values[0] == 42);
+	values.Clear();
+
+	// Random values: gMakeHeap then popping everything is a heap sort.
+	int rand_seed = 42;
+	for (int i = 0; i < 1000; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		values.PushBack(rand_seed % 100);
+	}
+
+	gMakeHeap(values.Begin(), values.End());
+	for (int size = values.Size(); size > 1; size--)
+		gPopHeap(values.Begin(), values.Begin() + size);
+	TEST_TRUE(sIsSorted(values));
+
+	// Building the heap incrementally with gPushHeap gives the same result.
+	Vector<int> incremental;
+	for (int value : values)
+	{
+		incremental.PushBack(value);
+		gPushHeap(incremental.Begin(), incremental.End());
+	}
+	TEST_TRUE(incremental[0] == values.Back()); // The highest value is at the top.
+
+	// Custom comparison: a greater-than comparison puts the lowest value on top and pops ascending.
+	auto greater = [](int inA, int inB) { return inA > inB; };
+	int lowest = values.Front(); // values is sorted ascending at this point.
+	gMakeHeap(values.Begin(), values.End(), greater);
+	TEST_TRUE(values[0] == lowest);
+	for (int size = values.Size(); size > 1; size--)
+		gPopHeap(values.Begin(), values.Begin() + size, greater);
+	TEST_TRUE(sIsSorted(values, greater)); // Descending.
+};
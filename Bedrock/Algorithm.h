@@ -3,6 +3,8 @@
 
 #include <Bedrock/Core.h>
 #include <Bedrock/Move.h>
+#include <Bedrock/Allocator.h>
+#include <Bedrock/PlacementNew.h>
 
 
 // Equivalent to std::swap
@@ -111,6 +113,27 @@ constexpr bool gEquals(const auto& inContainerA, const auto& inContainerB)
 }
 
 
+// Return true if a range is sorted.
+template<typename taIterator>
+constexpr bool gIsSorted(taIterator inBegin, taIterator inEnd)
+{
+	for (auto it = inBegin; it != inEnd && (it + 1) != inEnd; ++it)
+	{
+		if (*(it + 1) < *it)
+			return false;
+	}
+
+	return true;
+}
+
+
+// Return true if a vector-like container is sorted.
+constexpr bool gIsSorted(const auto& inContainer)
+{
+	return gIsSorted(inContainer.Begin(), inContainer.End());
+}
+
+
 // Lower bound implementation to avoid <algorithm>
 template<typename taIterator>
 constexpr taIterator gLowerBound(taIterator inFirst, taIterator inLast, const auto& inElem)
@@ -138,6 +161,33 @@ constexpr taIterator gLowerBound(taIterator inFirst, taIterator inLast, const au
 }
 
 
+// Lower bound variant taking a "less than" predicate comparing an element to the searched value.
+template<typename taIterator, typename taLessPred>
+constexpr taIterator gLowerBound(taIterator inFirst, taIterator inLast, const auto& inElem, taLessPred&& inLess)
+{
+	auto first = inFirst;
+	auto count = inLast - first;
+
+    while (count > 0)
+	{
+		auto count2 = count / 2;
+		auto mid    = first + count2;
+
+		if (inLess(*mid, inElem))
+		{
+			first = mid + 1;
+			count -= count2 + 1;
+		}
+		else
+		{
+			count = count2;
+		}
+    }
+
+	return first;
+}
+
+
 // Find a value in a sorted [inBegin, inEnd) range.
 template<typename taIterator>
 constexpr auto gFindSorted(taIterator inBegin, taIterator inEnd, const auto& inElem)
@@ -219,6 +269,455 @@ constexpr void gSwapErase(auto& inContainer, const auto& inIterator)
 }
 
 
+namespace Details
+{
+	// Default comparison for the sort functions.
+	struct SortLess
+	{
+		constexpr bool operator()(const auto& inA, const auto& inB) const { return inA < inB; }
+	};
+
+	// Below this size, ranges are sorted with an insertion sort.
+	constexpr int64 cSortInsertionThreshold = 24;
+
+
+	// Insertion sort. Efficient on small or nearly-sorted ranges.
+	template <typename taIterator, typename taCompare>
+	constexpr void sInsertionSort(taIterator inBegin, taIterator inEnd, taCompare& ioComp)
+	{
+		for (taIterator it = inBegin + 1; it < inEnd; ++it)
+		{
+			auto value = gMove(*it);
+
+			taIterator hole = it;
+			while (hole > inBegin && ioComp(value, *(hole - 1)))
+			{
+				*hole = gMove(*(hole - 1));
+				--hole;
+			}
+
+			*hole = gMove(value);
+		}
+	}
+
+
+	// Move the max-heap element at inRoot down until the heap property is restored.
+	template <typename taIterator, typename taCompare>
+	constexpr void sSiftHeapDown(taIterator inBegin, int64 inRoot, int64 inSize, taCompare& ioComp)
+	{
+		int64 root = inRoot;
+		while (true)
+		{
+			int64 child = 2 * root + 1;
+			if (child >= inSize)
+				break;
+
+			// Pick the larger of the two children.
+			if (child + 1 < inSize && ioComp(*(inBegin + child), *(inBegin + child + 1)))
+				child++;
+
+			if (!ioComp(*(inBegin + root), *(inBegin + child)))
+				break;
+
+			gSwap(*(inBegin + root), *(inBegin + child));
+			root = child;
+		}
+	}
+
+
+	// Heap sort. Used as a fallback to keep the worst case O(n log n).
+	template <typename taIterator, typename taCompare>
+	constexpr void sHeapSort(taIterator inBegin, taIterator inEnd, taCompare& ioComp)
+	{
+		int64 size = inEnd - inBegin;
+
+		// Build a max-heap.
+		for (int64 i = size / 2 - 1; i >= 0; i--)
+			sSiftHeapDown(inBegin, i, size, ioComp);
+
+		// Repeatedly move the max to the end and re-heapify.
+		for (int64 i = size - 1; i > 0; i--)
+		{
+			gSwap(*inBegin, *(inBegin + i));
+			sSiftHeapDown(inBegin, 0, i, ioComp);
+		}
+	}
+
+
+	// Partition [inBegin, inEnd) around a median-of-3 pivot using Hoare partitioning.
+	// Returns an iterator to the pivot's final position. The range must be larger than 3 elements.
+	template <typename taIterator, typename taCompare>
+	constexpr taIterator sMedianPartition(taIterator inBegin, taIterator inEnd, taCompare& ioComp)
+	{
+		// Sort first/middle/last so the median ends up in the middle.
+		// This also makes *(inEnd - 1) a sentinel for the partition loop below.
+		taIterator mid = inBegin + (inEnd - inBegin) / 2;
+		if (ioComp(*mid, *inBegin))
+			gSwap(*mid, *inBegin);
+		if (ioComp(*(inEnd - 1), *inBegin))
+			gSwap(*(inEnd - 1), *inBegin);
+		if (ioComp(*(inEnd - 1), *mid))
+			gSwap(*(inEnd - 1), *mid);
+
+		// Move the pivot out of the way, to the front.
+		gSwap(*inBegin, *mid);
+
+		// Hoare partition.
+		taIterator first = inBegin;
+		taIterator last  = inEnd;
+		while (true)
+		{
+			do { ++first; } while (ioComp(*first, *inBegin));
+			do { --last; } while (ioComp(*inBegin, *last));
+
+			if (first >= last)
+				break;
+
+			gSwap(*first, *last);
+		}
+
+		// Place the pivot at its final position.
+		gSwap(*inBegin, *last);
+		return last;
+	}
+
+
+	// Quicksort core: median-of-3 pivot, Hoare partitioning, recursion on the smaller side only,
+	// and a depth limit that falls back to heap sort on adversarial patterns.
+	template <typename taIterator, typename taCompare>
+	constexpr void sIntroSort(taIterator inBegin, taIterator inEnd, int inDepthLimit, taCompare& ioComp)
+	{
+		while (inEnd - inBegin > cSortInsertionThreshold)
+		{
+			if (inDepthLimit == 0)
+			{
+				// Too many bad pivots, switch to heap sort to avoid quadratic behavior.
+				sHeapSort(inBegin, inEnd, ioComp);
+				return;
+			}
+			inDepthLimit--;
+
+			taIterator pivot = sMedianPartition(inBegin, inEnd, ioComp);
+
+			// Recurse on the smaller partition, loop on the larger one (bounds the recursion depth).
+			if (pivot - inBegin < inEnd - (pivot + 1))
+			{
+				sIntroSort(inBegin, pivot, inDepthLimit, ioComp);
+				inBegin = pivot + 1;
+			}
+			else
+			{
+				sIntroSort(pivot + 1, inEnd, inDepthLimit, ioComp);
+				inEnd = pivot;
+			}
+		}
+
+		sInsertionSort(inBegin, inEnd, ioComp);
+	}
+
+
+	// Merge two consecutive sorted runs from inSource into ioDest (raw memory, elements are move-constructed).
+	template <typename taValue, typename taCompare>
+	void sMergeRuns(taValue* inSource, taValue* ioDest, int64 inBegin, int64 inMid, int64 inEnd, taCompare& ioComp)
+	{
+		int64 left  = inBegin;
+		int64 right = inMid;
+
+		for (int64 i = inBegin; i < inEnd; i++)
+		{
+			// Take from the left run unless the right element is strictly smaller (keeps the sort stable).
+			if (left < inMid && (right >= inEnd || !ioComp(inSource[right], inSource[left])))
+				gPlacementNew(ioDest[i], gMove(inSource[left++]));
+			else
+				gPlacementNew(ioDest[i], gMove(inSource[right++]));
+		}
+	}
+}
+
+
+// Sort a [inBegin, inEnd) range. Not stable (equal elements may be reordered).
+template <typename taIterator, typename taCompare = Details::SortLess>
+constexpr void gSort(taIterator inBegin, taIterator inEnd, taCompare ioComp = {})
+{
+	int64 size = inEnd - inBegin;
+	if (size <= 1)
+		return;
+
+	// Depth limit is 2 * log2(size), past that heap sort takes over.
+	int depth_limit = 0;
+	for (int64 s = size; s > 0; s /= 2)
+		depth_limit += 2;
+
+	Details::sIntroSort(inBegin, inEnd, depth_limit, ioComp);
+}
+
+
+// Sort a vector-like container. Not stable (equal elements may be reordered).
+template <typename taContainer, typename taCompare = Details::SortLess>
+constexpr void gSort(taContainer& ioContainer, taCompare ioComp = {}) requires requires { ioContainer.Begin(); }
+{
+	gSort(ioContainer.Begin(), ioContainer.End(), gMove(ioComp));
+}
+
+
+// Sort a [inBegin, inEnd) range, keeping equal elements in their original order.
+// Uses a scratch buffer of the same size, allocated from temp memory.
+template <typename taIterator, typename taCompare = Details::SortLess>
+void gStableSort(taIterator inBegin, taIterator inEnd, taCompare ioComp = {})
+{
+	using ValueType = RemoveReference<decltype(*inBegin)>;
+
+	int64 size = inEnd - inBegin;
+	if (size <= 1)
+		return;
+
+	// Sort small runs with an insertion sort (it is stable), then merge them bottom-up.
+	for (int64 run_begin = 0; run_begin < size; run_begin += Details::cSortInsertionThreshold)
+	{
+		int64 run_end = gMin(run_begin + Details::cSortInsertionThreshold, size);
+		Details::sInsertionSort(inBegin + run_begin, inBegin + run_end, ioComp);
+	}
+
+	if (size <= Details::cSortInsertionThreshold)
+		return; // Single run, already sorted.
+
+	ValueType* data    = &*inBegin;
+	ValueType* scratch = TempAllocator<ValueType>::Allocate((int)size);
+	defer { TempAllocator<ValueType>::Free(scratch, (int)size); };
+
+	for (int64 run_size = Details::cSortInsertionThreshold; run_size < size; run_size *= 2)
+	{
+		// Merge pairs of runs into the scratch buffer.
+		for (int64 run_begin = 0; run_begin < size; run_begin += 2 * run_size)
+		{
+			int64 run_mid = gMin(run_begin + run_size, size);
+			int64 run_end = gMin(run_begin + 2 * run_size, size);
+			Details::sMergeRuns(data, scratch, run_begin, run_mid, run_end, ioComp);
+		}
+
+		// Move everything back and destroy the scratch elements.
+		for (int64 i = 0; i < size; i++)
+		{
+			data[i] = gMove(scratch[i]);
+			scratch[i].~ValueType();
+		}
+	}
+}
+
+
+// Sort a vector-like container, keeping equal elements in their original order.
+template <typename taContainer, typename taCompare = Details::SortLess>
+void gStableSort(taContainer& ioContainer, taCompare ioComp = {}) requires requires { ioContainer.Begin(); }
+{
+	gStableSort(ioContainer.Begin(), ioContainer.End(), gMove(ioComp));
+}
+
+
+namespace Details
+{
+	// Key extraction for the plain gRadixSort overloads (the value is its own key).
+	struct RadixIdentityKey
+	{
+		constexpr auto operator()(const auto& inValue) const { return inValue; }
+	};
+
+	// Convert an integral key to an unsigned integer that sorts in the same order.
+	template <typename taKey>
+	force_inline uint64 sRadixKey(taKey inKey)
+	{
+		static_assert(cIsIntegral<taKey>, "gRadixSort keys must be integral.");
+
+		uint64 key = (uint64)inKey;
+
+		// Signed keys: flipping the sign bit makes negative values sort before positive ones.
+		if constexpr (taKey(-1) < taKey(0))
+			key ^= (uint64)1 << (8 * sizeof(taKey) - 1);
+
+		return key;
+	}
+}
+
+
+// Sort a [inBegin, inEnd) range by an integral key returned by inGetKey. Stable.
+// LSD radix sort, one pass per key byte, with a scratch buffer allocated from temp memory.
+// Much faster than comparison sorts on large ranges, but only supports integral keys
+// and trivially copyable elements.
+template <typename taIterator, typename taGetKey>
+void gRadixSort(taIterator inBegin, taIterator inEnd, const taGetKey& inGetKey)
+{
+	using ValueType = RemoveReference<decltype(*inBegin)>;
+	using KeyType   = RemoveCV<RemoveReference<decltype(inGetKey(*inBegin))>>;
+
+	static_assert(cIsTriviallyCopyable<ValueType>, "gRadixSort only supports trivially copyable elements.");
+	constexpr int cNumPasses = (int)sizeof(KeyType);
+
+	int size = (int)(inEnd - inBegin);
+	if (size <= 1)
+		return;
+
+	ValueType* data    = &*inBegin;
+	ValueType* scratch = TempAllocator<ValueType>::Allocate(size);
+	defer { TempAllocator<ValueType>::Free(scratch, size); };
+
+	// Build the histograms for every pass in a single read over the data.
+	int counts[cNumPasses][256] = {};
+	for (int i = 0; i < size; i++)
+	{
+		uint64 key = Details::sRadixKey(inGetKey(data[i]));
+		for (int pass = 0; pass < cNumPasses; pass++)
+			counts[pass][(key >> (8 * pass)) & 0xFF]++;
+	}
+
+	ValueType* src = data;
+	ValueType* dst = scratch;
+
+	for (int pass = 0; pass < cNumPasses; pass++)
+	{
+		// Skip the pass entirely if all keys share the same byte (common for the high bytes).
+		bool all_same = false;
+		for (int count : counts[pass])
+			if (count == size)
+			{
+				all_same = true;
+				break;
+			}
+		if (all_same)
+			continue;
+
+		// Turn the histogram into start offsets.
+		int offsets[256];
+		int sum = 0;
+		for (int i = 0; i < 256; i++)
+		{
+			offsets[i] = sum;
+			sum += counts[pass][i];
+		}
+
+		// Scatter the elements into the other buffer.
+		int shift = 8 * pass;
+		for (int i = 0; i < size; i++)
+		{
+			int byte = (int)((Details::sRadixKey(inGetKey(src[i])) >> shift) & 0xFF);
+			dst[offsets[byte]++] = src[i];
+		}
+
+		gSwap(src, dst);
+	}
+
+	// If the last executed pass ended up in the scratch buffer, copy the result back.
+	if (src != data)
+		gMemCopy(data, src, size * (int)sizeof(ValueType));
+}
+
+
+// Sort a [inBegin, inEnd) range of integral values. Stable. See gRadixSort above.
+template <typename taIterator>
+void gRadixSort(taIterator inBegin, taIterator inEnd)
+{
+	gRadixSort(inBegin, inEnd, Details::RadixIdentityKey{});
+}
+
+
+// Sort a vector-like container by an integral key returned by inGetKey. Stable. See gRadixSort above.
+template <typename taContainer, typename taGetKey = Details::RadixIdentityKey>
+void gRadixSort(taContainer& ioContainer, const taGetKey& inGetKey = {}) requires requires { ioContainer.Begin(); }
+{
+	gRadixSort(ioContainer.Begin(), ioContainer.End(), inGetKey);
+}
+
+
+namespace Details
+{
+	// Arity of the heap used by the gHeap functions. With 4 children per node they are adjacent in
+	// memory (one cache line for small types), so sifting down scans them without extra cache misses,
+	// and the tree is half as deep as a binary heap.
+	constexpr int64 cHeapArity = 4;
+
+	// Move the element at inHole up towards the root until its parent compares higher.
+	template <typename taIterator, typename taCompare>
+	constexpr void sHeapSiftUp(taIterator inBegin, int64 inHole, taCompare& ioComp)
+	{
+		auto value = gMove(*(inBegin + inHole));
+
+		while (inHole > 0)
+		{
+			int64 parent = (inHole - 1) / cHeapArity;
+			if (!ioComp(*(inBegin + parent), value))
+				break;
+
+			*(inBegin + inHole) = gMove(*(inBegin + parent));
+			inHole = parent;
+		}
+
+		*(inBegin + inHole) = gMove(value);
+	}
+
+	// Move the element at inHole down towards the leaves until all its children compare lower.
+	template <typename taIterator, typename taCompare>
+	constexpr void sHeapSiftDown(taIterator inBegin, int64 inSize, int64 inHole, taCompare& ioComp)
+	{
+		auto value = gMove(*(inBegin + inHole));
+
+		while (true)
+		{
+			int64 first_child = inHole * cHeapArity + 1;
+			if (first_child >= inSize)
+				break;
+
+			// Find the highest of the (up to 4 adjacent) children.
+			int64 last_child    = gMin(first_child + cHeapArity, inSize);
+			int64 highest_child = first_child;
+			for (int64 child = first_child + 1; child < last_child; child++)
+				if (ioComp(*(inBegin + highest_child), *(inBegin + child)))
+					highest_child = child;
+
+			if (!ioComp(value, *(inBegin + highest_child)))
+				break;
+
+			*(inBegin + inHole) = gMove(*(inBegin + highest_child));
+			inHole = highest_child;
+		}
+
+		*(inBegin + inHole) = gMove(value);
+	}
+}
+
+
+// Rearrange [inBegin, inEnd) into a heap: the highest element (according to ioComp) ends up at inBegin.
+template <typename taIterator, typename taCompare = Details::SortLess>
+constexpr void gMakeHeap(taIterator inBegin, taIterator inEnd, taCompare ioComp = {})
+{
+	int64 size = inEnd - inBegin;
+	if (size <= 1)
+		return;
+
+	// Sift down every internal node, last one first.
+	for (int64 i = (size - 2) / Details::cHeapArity; i >= 0; i--)
+		Details::sHeapSiftDown(inBegin, size, i, ioComp);
+}
+
+
+// Add the element at (inEnd - 1) to the heap in [inBegin, inEnd - 1).
+template <typename taIterator, typename taCompare = Details::SortLess>
+constexpr void gPushHeap(taIterator inBegin, taIterator inEnd, taCompare ioComp = {})
+{
+	Details::sHeapSiftUp(inBegin, inEnd - inBegin - 1, ioComp);
+}
+
+
+// Move the highest element of the heap in [inBegin, inEnd) to (inEnd - 1), keeping the rest a heap.
+template <typename taIterator, typename taCompare = Details::SortLess>
+constexpr void gPopHeap(taIterator inBegin, taIterator inEnd, taCompare ioComp = {})
+{
+	int64 size = inEnd - inBegin;
+	if (size <= 1)
+		return;
+
+	gSwap(*inBegin, *(inEnd - 1));
+	Details::sHeapSiftDown(inBegin, size - 1, 0, ioComp);
+}
+
+
 // Remove the first value that matches predicate from a vector-like container.
 constexpr bool gSwapEraseFirstIf(auto& inContainer, const auto& inPredicate)
 {
@@ -19,8 +19,8 @@ struct DefaultAllocator
 
 
 
-// Temp memory allocator. Allocates from a thread-local global MemArena.
-// Falls back to the default allocator if temp memory runs out.
+// Temp memory allocator. Allocates from the thread-local gTempMemArena, which chains in overflow
+// blocks when its initial one runs out (see TempMemory.h).
 template <typename taType>
 struct TempAllocator
 {
@@ -68,8 +68,8 @@ struct VMemAllocator
 	static constexpr int64 cDefaultCommitSize   = MemArenaType::cDefaultCommitSize;   // By default the arena will commit that much virtual memory every time it grows.
 
 	VMemAllocator() = default;
-	VMemAllocator(int inReservedSizeInBytes, int inCommitIncreaseSizeInBytes = cDefaultCommitSize)
-		: mArena(inReservedSizeInBytes, inCommitIncreaseSizeInBytes) {}
+	VMemAllocator(int inReservedSizeInBytes, int inCommitIncreaseSizeInBytes = cDefaultCommitSize, EVMemLargePages inLargePages = EVMemLargePages::No)
+		: mArena(inReservedSizeInBytes, inCommitIncreaseSizeInBytes, inLargePages) {}
 
 	// Allocate memory.
 	taType*				Allocate(int inSize)				{ return (taType*)mArena.Alloc(inSize * sizeof(taType)).mPtr; }
@@ -109,6 +109,47 @@ private:
 
 
 
+// Serves the first taSize elements from storage embedded in the allocator itself,
+// and falls back to the heap for anything larger.
+template <typename taType, int taSize>
+struct InlineAllocator
+{
+	// Allocate memory.
+	taType*	Allocate(int inSize)
+	{
+		if (inSize <= taSize)
+			return InlineData();
+
+		return DefaultAllocator<taType>::Allocate(inSize);
+	}
+
+	void	Free(taType* inPtr, int inSize)
+	{
+		if (inPtr != InlineData())
+			DefaultAllocator<taType>::Free(inPtr, inSize);
+	}
+
+	// Try changing the size of an existing allocation, return false if unsuccessful.
+	bool	TryRealloc(taType* inPtr, int inCurrentSize, int inNewSize)
+	{
+		gAssert(inPtr != nullptr); // Call Allocate instead.
+
+		// Growing (or shrinking) works as long as it's the inline storage and the new size fits.
+		return inPtr == InlineData() && inNewSize <= taSize;
+	}
+
+	// Return true if this pointer is the allocator's embedded storage.
+	// The presence of this method also tells Vector that the data can't be stolen when moving.
+	bool	IsInlineData(const taType* inPtr) const	{ return inPtr == (const taType*)mStorage; }
+
+	taType*	InlineData()							{ return (taType*)mStorage; }
+
+private:
+	alignas(taType) uint8 mStorage[taSize * sizeof(taType)];
+};
+
+
+
 template <typename taType>
 taType* TempAllocator<taType>::Allocate(int inSize)
 {
@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/AsyncIO.h>
+
+#include <Bedrock/Atomic.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/TaskScheduler.h>
+#include <Bedrock/Test.h>
+
+#include <stdio.h>
+#include <Windows.h>
+
+
+static_assert(sizeof(OVERLAPPED) <= sizeof(Details::AsyncIORequest::mOverlapped));
+static_assert(alignof(OVERLAPPED) <= alignof(Details::AsyncIORequest));
+
+static constexpr int cRequestsPerChunk = 64;
+
+
+void AsyncFile::Close()
+{
+	if (mFile != nullptr)
+		CloseHandle(mFile);
+
+	mFile = nullptr;
+	mSize = 0;
+}
+
+
+void AsyncFile::MoveFrom(AsyncFile&& ioOther)
+{
+	Close();
+
+	mFile = ioOther.mFile;
+	mSize = ioOther.mSize;
+
+	ioOther.mFile = nullptr;
+	ioOther.mSize = 0;
+}
+
+
+AsyncIOQueue::AsyncIOQueue(const AsyncIOQueueConfig& inConfig)
+{
+	mScheduler = inConfig.mScheduler;
+
+	mPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+	gAssert(mPort != nullptr);
+}
+
+
+AsyncIOQueue::~AsyncIOQueue()
+{
+	WaitAll();
+
+	CloseHandle(mPort);
+
+	for (MemBlock chunk : mRequestChunks)
+		gMemFree(chunk);
+}
+
+
+bool AsyncIOQueue::Open(StringView inPath, AsyncFile& outFile)
+{
+	outFile.Close();
+
+	HANDLE file = CreateFileA(inPath.AsCStr(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER file_size = {};
+	if (!GetFileSizeEx(file, &file_size))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// Associate the file with the completion port; its reads will post their completions there.
+	if (CreateIoCompletionPort(file, mPort, 0, 0) != mPort)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	outFile.mFile = file;
+	outFile.mSize = file_size.QuadPart;
+	return true;
+}
+
+
+bool AsyncIOQueue::ReadAsync(AsyncFile& ioFile, int64 inOffset, Span<uint8> outBuffer, ReadCallback&& ioCallback)
+{
+	gAssert(ioFile.IsOpen());
+	gAssert(inOffset >= 0);
+	gAssert(!outBuffer.Empty());
+
+	Details::AsyncIORequest* request = AllocRequest();
+	request->mCallback = gMove(ioCallback);
+	request->mBuffer   = outBuffer.Data();
+
+	auto overlapped = (OVERLAPPED*)request->mOverlapped;
+	*overlapped            = {};
+	overlapped->Offset     = (DWORD)(inOffset & 0xFFFFFFFF);
+	overlapped->OffsetHigh = (DWORD)(inOffset >> 32);
+
+	if (!ReadFile(ioFile.mFile, outBuffer.Data(), (DWORD)outBuffer.Size(), nullptr, overlapped)
+		&& GetLastError() != ERROR_IO_PENDING)
+	{
+		// Failed to submit (eg. reading past the end), no completion will be posted.
+		request->mCallback = {};
+		FreeRequest(request);
+		return false;
+	}
+
+	// Submitted; even reads that completed synchronously post a completion to the port.
+	mNumPending++;
+	return true;
+}
+
+
+int AsyncIOQueue::Poll()
+{
+	return PumpCompletions(false);
+}
+
+
+int AsyncIOQueue::Wait()
+{
+	return PumpCompletions(true);
+}
+
+
+void AsyncIOQueue::WaitAll()
+{
+	while (mNumPending > 0)
+		PumpCompletions(true);
+}
+
+
+int AsyncIOQueue::PumpCompletions(bool inWait)
+{
+	int num_dispatched = 0;
+
+	while (mNumPending > 0)
+	{
+		DWORD       num_bytes  = 0;
+		ULONG_PTR   key        = 0;
+		OVERLAPPED* overlapped = nullptr;
+		DWORD       timeout    = (inWait && num_dispatched == 0) ? INFINITE : 0;
+
+		BOOL success = GetQueuedCompletionStatus(mPort, &num_bytes, &key, &overlapped, timeout);
+		if (overlapped == nullptr)
+			break; // Timed out, nothing ready.
+
+		// The OVERLAPPED is the first member of the request.
+		auto request = (Details::AsyncIORequest*)overlapped;
+		mNumPending--;
+		num_dispatched++;
+
+		// A read crossing the end of the file completes with ERROR_HANDLE_EOF and the bytes before it.
+		int bytes_read = success ? (int)num_bytes : 0;
+
+		if (mScheduler != nullptr)
+		{
+			mScheduler->Submit([this, request, success = (success != 0), bytes_read] {
+				request->mCallback(success, Span<uint8>(request->mBuffer, bytes_read));
+				FreeRequest(request);
+			});
+		}
+		else
+		{
+			// Move the callback out and free the request before calling it, so the callback can
+			// submit new reads without growing the pool.
+			Function<void(bool, Span<uint8>)> callback = gMove(request->mCallback);
+			Span<uint8>                       bytes(request->mBuffer, bytes_read);
+			FreeRequest(request);
+
+			callback(success != 0, bytes);
+		}
+	}
+
+	return num_dispatched;
+}
+
+
+Details::AsyncIORequest* AsyncIOQueue::AllocRequest()
+{
+	LockGuard lock(mFreeRequestsMutex);
+
+	if (mFreeRequests == nullptr)
+	{
+		// Allocate a new chunk of request nodes and add them to the free list.
+		MemBlock chunk = gMemAlloc(cRequestsPerChunk * sizeof(Details::AsyncIORequest));
+		mRequestChunks.PushBack(chunk);
+
+		auto requests = (Details::AsyncIORequest*)chunk.mPtr;
+		for (int i = 0; i < cRequestsPerChunk; i++)
+		{
+			gPlacementNew(requests[i]);
+			requests[i].mNextFree = mFreeRequests;
+			mFreeRequests         = &requests[i];
+		}
+	}
+
+	Details::AsyncIORequest* request = mFreeRequests;
+	mFreeRequests     = request->mNextFree;
+	request->mNextFree = nullptr;
+	return request;
+}
+
+
+void AsyncIOQueue::FreeRequest(Details::AsyncIORequest* ioRequest)
+{
+	ioRequest->mCallback = {};
+	ioRequest->mBuffer   = nullptr;
+
+	LockGuard lock(mFreeRequestsMutex);
+
+	ioRequest->mNextFree = mFreeRequests;
+	mFreeRequests        = ioRequest;
+}
+
+
+REGISTER_TEST("AsyncIO")
+{
+	// Write a test file the regular way: 1000 int32s with predictable values.
+	const char*   test_path = "bedrock_async_io_test.tmp";
+	constexpr int cNumInts  = 1000;
+	{
+		FILE* file = fopen(test_path, "wb");
+		TEST_TRUE(file != nullptr);
+		for (int i = 0; i < cNumInts; i++)
+			fwrite(&i, sizeof(i), 1, file);
+		fclose(file);
+	}
+
+	AsyncIOQueue queue;
+
+	// Opening a file that doesn't exist fails.
+	AsyncFile missing;
+	TEST_FALSE(queue.Open("bedrock_async_io_test_does_not_exist.tmp", missing));
+
+	AsyncFile file;
+	TEST_TRUE(queue.Open(test_path, file));
+	TEST_TRUE(file.GetSize() == cNumInts * (int)sizeof(int));
+
+	// Submit many small reads at scattered offsets, all in flight at once.
+	constexpr int cNumReads = 100;
+	int           values[cNumReads]    = {};
+	int           num_completed        = 0;
+	bool          all_succeeded        = true;
+
+	for (int i = 0; i < cNumReads; i++)
+	{
+		// Read the value at index i * 10.
+		int64 offset = (int64)(i * 10) * sizeof(int);
+		Span  buffer((uint8*)&values[i], (int)sizeof(int));
+
+		TEST_TRUE(queue.ReadAsync(file, offset, buffer, [&num_completed, &all_succeeded](bool inSuccess, Span<uint8> inBytes) {
+			num_completed++;
+			all_succeeded = all_succeeded && inSuccess && inBytes.Size() == sizeof(int);
+		}));
+	}
+	TEST_TRUE(queue.GetNumPendingReads() == cNumReads);
+
+	queue.WaitAll();
+	TEST_TRUE(queue.GetNumPendingReads() == 0);
+	TEST_TRUE(num_completed == cNumReads);
+	TEST_TRUE(all_succeeded);
+
+	for (int i = 0; i < cNumReads; i++)
+		TEST_TRUE(values[i] == i * 10);
+
+	// A read crossing the end of the file completes with just the bytes before it.
+	uint8 tail_buffer[100] = {};
+	int   tail_bytes       = -1;
+	TEST_TRUE(queue.ReadAsync(file, file.GetSize() - 8, Span(tail_buffer), [&tail_bytes](bool inSuccess, Span<uint8> inBytes) {
+		tail_bytes = inSuccess ? inBytes.Size() : -1;
+	}));
+	queue.WaitAll();
+	TEST_TRUE(tail_bytes == 8);
+
+	// A read entirely past the end fails to submit.
+	TEST_FALSE(queue.ReadAsync(file, file.GetSize() + 100, Span(tail_buffer), [](bool, Span<uint8>) {}));
+	TEST_TRUE(queue.GetNumPendingReads() == 0);
+
+	file.Close();
+	remove(test_path);
+};
+
+
+REGISTER_TEST("AsyncIO TaskScheduler")
+{
+	const char* test_path = "bedrock_async_io_task_test.tmp";
+	{
+		FILE* file = fopen(test_path, "wb");
+		TEST_TRUE(file != nullptr);
+		for (int i = 0; i < 100; i++)
+			fwrite(&i, sizeof(i), 1, file);
+		fclose(file);
+	}
+
+	{
+		TaskScheduler scheduler;
+		scheduler.Init({ .mNumWorkers = 2 });
+
+		// Completions are dispatched as tasks; the callbacks run on worker threads.
+		AsyncIOQueue queue({ .mScheduler = &scheduler });
+		AsyncFile    file;
+		TEST_TRUE(queue.Open(test_path, file));
+
+		constexpr int cNumReads = 20;
+		int           values[cNumReads] = {};
+		AtomicInt32   num_completed     = 0;
+
+		for (int i = 0; i < cNumReads; i++)
+		{
+			int64 offset = (int64)i * sizeof(int);
+			TEST_TRUE(queue.ReadAsync(file, offset, Span((uint8*)&values[i], (int)sizeof(int)), [&num_completed](bool, Span<uint8>) {
+				num_completed.Add(1);
+			}));
+		}
+
+		queue.WaitAll();
+
+		// The tasks may still be running; Shutdown waits for them.
+		scheduler.Shutdown();
+		TEST_TRUE(num_completed.Load() == cNumReads);
+
+		for (int i = 0; i < cNumReads; i++)
+			TEST_TRUE(values[i] == i);
+	}
+
+	remove(test_path);
+};
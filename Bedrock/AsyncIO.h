@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Function.h>
+#include <Bedrock/Memory.h>
+#include <Bedrock/Mutex.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/StringView.h>
+#include <Bedrock/Vector.h>
+
+
+struct TaskScheduler;
+struct AsyncIOQueue;
+
+namespace Details
+{
+	// An in-flight read as stored internally by the queue.
+	struct AsyncIORequest
+	{
+		// The OS writes its completion data here. Kept as raw storage to avoid pulling OS headers
+		// into this header; must be the first member (completions hand back a pointer to it).
+		alignas(8) uint8 mOverlapped[32] = {};
+
+		Function<void(bool, Span<uint8>)> mCallback;
+		uint8*                            mBuffer   = nullptr;
+		AsyncIORequest*                   mNextFree = nullptr;
+	};
+}
+
+
+// A file opened for asynchronous reads. See AsyncIOQueue::Open.
+struct AsyncFile : NoCopy
+{
+	AsyncFile() = default;
+	~AsyncFile() { Close(); }
+
+	// Move
+	AsyncFile(AsyncFile&& ioOther) { MoveFrom((AsyncFile&&)ioOther); }
+	AsyncFile& operator=(AsyncFile&& ioOther) { MoveFrom((AsyncFile&&)ioOther); return *this; }
+
+	bool  IsOpen() const { return mFile != nullptr; }
+	int64 GetSize() const { return mSize; }
+
+	// Close the file. Don't call with reads still in flight.
+	void Close();
+
+private:
+	friend struct AsyncIOQueue;
+
+	void MoveFrom(AsyncFile&& ioOther);
+
+	void* mFile = nullptr; // Win32 file handle.
+	int64 mSize = 0;
+};
+
+
+struct AsyncIOQueueConfig
+{
+	TaskScheduler* mScheduler = nullptr; // If set, completion callbacks are submitted as tasks instead of being called inside Poll/Wait.
+};
+
+
+// Asynchronous (overlapped) file reads, batched through one completion port.
+// Submit any number of reads with ReadAsync to keep the drive's queue fed, then harvest the
+// completions with Poll (non-blocking) or Wait; each completed read invokes its callback with the
+// bytes actually transferred. One synchronous read per asset leaves an NVMe drive at queue depth
+// one, an order of magnitude below what it can deliver on cold loads.
+// Submitting and polling are meant to happen on the thread owning the queue; with a TaskScheduler
+// configured, the callbacks themselves run as tasks on any worker.
+struct AsyncIOQueue : NoCopy
+{
+	// Called on completion with the bytes that were read (empty on failure).
+	using ReadCallback = Function<void(bool inSuccess, Span<uint8> inBytes)>;
+
+	explicit AsyncIOQueue(const AsyncIOQueueConfig& inConfig = {});
+	~AsyncIOQueue(); // Waits for the in-flight reads. With a TaskScheduler, also wait for the dispatched tasks before destroying the queue.
+
+	// Open a file for async reads on this queue. Returns false if it doesn't exist or can't be opened.
+	bool Open(StringView inPath, AsyncFile& outFile);
+
+	// Read outBuffer.Size() bytes from the file at inOffset. The callback fires during a later
+	// Poll/Wait, with fewer bytes than asked if the read crosses the end of the file.
+	// Returns false if the read could not be submitted (eg. the offset is past the end).
+	bool ReadAsync(AsyncFile& ioFile, int64 inOffset, Span<uint8> outBuffer, ReadCallback&& ioCallback);
+
+	// Dispatch the completions that are ready. Returns how many were dispatched.
+	int Poll();
+
+	// Block until at least one read completes (if any is in flight), then dispatch like Poll.
+	int Wait();
+
+	// Block until every in-flight read completed and was dispatched.
+	void WaitAll();
+
+	int GetNumPendingReads() const { return mNumPending; }
+
+private:
+	Details::AsyncIORequest* AllocRequest();
+	void                     FreeRequest(Details::AsyncIORequest* ioRequest);
+	int                      PumpCompletions(bool inWait);
+
+	void*                    mPort       = nullptr; // Win32 completion port handle.
+	int                      mNumPending = 0;
+	TaskScheduler*           mScheduler  = nullptr;
+	Mutex                    mFreeRequestsMutex;    // Tasks free their request from worker threads.
+	Details::AsyncIORequest* mFreeRequests = nullptr; // Free list of request nodes, guarded by mFreeRequestsMutex.
+	Vector<MemBlock>         mRequestChunks;          // Allocations backing the request nodes, guarded by mFreeRequestsMutex.
+};
@@ -1,8 +1,35 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/Atomic.h>
 #include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
 #include <Bedrock/TypeTraits.h>
 
+#define VC_EXTRALEAN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+// WaitOnAddress & friends live there, and it's not one of the default libs.
+#pragma comment(lib, "synchronization.lib")
+
+
+void Details::gWaitOnAddress(const void* inAddress, const void* inExpected, int inSize)
+{
+	WaitOnAddress(const_cast<volatile void*>((const volatile void*)inAddress), const_cast<void*>(inExpected), inSize, INFINITE);
+}
+
+
+void Details::gWakeByAddressOne(void* inAddress)
+{
+	WakeByAddressSingle(inAddress);
+}
+
+
+void Details::gWakeByAddressAll(void* inAddress)
+{
+	WakeByAddressAll(inAddress);
+}
+
 
 template <typename taType>
 static void sTestAtomic(Atomic<taType>& ioAtomic, MemoryOrder inMemoryOrder, auto inA, auto inB)
@@ -98,6 +125,58 @@ REGISTER_TEST("AtomicPtr")
 };
 
 
+REGISTER_TEST("AtomicTaggedPtr")
+{
+	int test;
+	Atomic<TaggedPtr<int>> atomic;
+	static_assert(sizeof(TaggedPtr<int>) == 16);
+
+	sTestAtomic(atomic, MemoryOrder::Relaxed, TaggedPtr<int>{ &test, 1 }, TaggedPtr<int>{ &test + 100, 2 });
+	sTestAtomic(atomic, MemoryOrder::SeqCst, TaggedPtr<int>{ &test, 1 }, TaggedPtr<int>{ &test + 100, 2 });
+
+	// The tag makes a recycled pointer distinguishable: same address, different generation.
+	atomic.Store({ &test, 2 });
+	TaggedPtr<int> expected = { &test, 1 };
+	TEST_FALSE(atomic.CompareExchange(expected, { nullptr, 0 }));
+	TEST_TRUE(expected == TaggedPtr<int>{ &test, 2 });
+	TEST_TRUE(atomic.CompareExchange(expected, { nullptr, 3 }));
+	TEST_TRUE(atomic.Load() == TaggedPtr<int>{ nullptr, 3 });
+};
+
+
+REGISTER_TEST("AtomicWait")
+{
+	AtomicInt32 value = 1;
+
+	// Waiting on a value the atomic doesn't hold returns immediately.
+	gWait(value, 0);
+
+	// Ping-pong between two threads, blocking on the atomic itself.
+	value.Store(0);
+	AtomicInt32 sum = 0;
+	Thread other;
+	other.Create({}, [&value, &sum](Thread&)
+	{
+		for (int i = 0; i < 100; i++)
+		{
+			gWait(value, 0);		// Wait for main to set it.
+			sum.Add(value.Exchange(0));
+			gWakeOne(value);
+		}
+	});
+
+	for (int i = 0; i < 100; i++)
+	{
+		value.Store(i + 1);
+		gWakeOne(value);
+		gWait(value, i + 1);	// Wait for the other thread to take it.
+	}
+
+	other.Join();
+	TEST_TRUE(sum.Load() == 100 * 101 / 2);
+};
+
+
 REGISTER_TEST("AtomicEnum")
 {
 	enum class TestEnum : int { A, B };
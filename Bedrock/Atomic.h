@@ -19,6 +19,7 @@ extern "C"
 	__int64 _InterlockedExchange64(__int64 volatile*, __int64);
 	__int64 _InterlockedExchangeAdd64(__int64 volatile*, __int64);
 	__int64 _InterlockedCompareExchange64(__int64 volatile*, __int64, __int64);
+	unsigned char _InterlockedCompareExchange128(__int64 volatile*, __int64, __int64, __int64*);
 	__int8  __iso_volatile_load8(const volatile __int8*);
 	__int32 __iso_volatile_load32(const volatile __int32*);
 	__int64 __iso_volatile_load64(const volatile __int64*);
@@ -38,23 +39,39 @@ enum class MemoryOrder
 {
 	Relaxed,
 	//Consume,	// TODO?
-	//Acquire,
-	//Release,
+	Acquire,	// Only valid for loads (and the read part of read-modify-writes).
+	Release,	// Only valid for stores (and the write part of read-modify-writes).
 	//AcqRel,
 	SeqCst,
 };
 
 
+namespace Details
+{
+	// Storage for 16 byte atomics. cmpxchg16b operates on two 8 byte halves.
+	struct alignas(16) AtomicStorage128
+	{
+		bool operator==(const AtomicStorage128&) const = default;
+
+		int64 mLow;
+		int64 mHigh;
+	};
+}
+
+
 // Atomic template class.
-// Supports integral types (including bool), pointers and trivially copyable classes <= 8 bytes. Lock-free only.
+// Supports integral types (including bool), pointers and trivially copyable classes <= 16 bytes. Lock-free only.
+// Note: 16 byte support is based on cmpxchg16b, so every operation (including Load) is a read-modify-write.
 template<typename taType>
 struct Atomic : NoCopy
 {
 	static_assert(cIsTriviallyCopyable<taType>);
-	static_assert(sizeof(taType) == 8 || sizeof(taType) == 4 || sizeof(taType) == 1); // Note: int16 not supported only because not needed so far.
+	static_assert(sizeof(taType) == 16 || sizeof(taType) == 8 || sizeof(taType) == 4 || sizeof(taType) == 1); // Note: int16 not supported only because not needed so far.
 
 	using ValueType = taType;
-	using StorageType = Conditional<sizeof(taType) == 8, int64, Conditional<sizeof(taType) == 4, int32, char>>; // An integral type that can hold the value.
+	using StorageType = Conditional<sizeof(taType) == 16, Details::AtomicStorage128,
+						Conditional<sizeof(taType) == 8, int64,
+						Conditional<sizeof(taType) == 4, int32, char>>>; // A type that can hold the value and that the interlocked functions understand.
 
 	static_assert(sizeof(ValueType) == sizeof(StorageType));
 
@@ -75,7 +92,7 @@ private:
 	static force_inline ValueType	sAsValue(StorageType inStorage);
 	static force_inline StorageType	sAsStorage(ValueType inValue);
 
-	ValueType	mValue; // Note: This could be StorageType, but ValueType looks nicer in the debugger.
+	alignas(sizeof(taType)) ValueType mValue; // Note: This could be StorageType, but ValueType looks nicer in the debugger. Alignment because cmpxchg16b needs 16 byte aligned operands.
 };
 
 
@@ -86,23 +103,85 @@ using AtomicInt64 = Atomic<int64>;
 using AtomicBool = Atomic<bool>;
 
 
+// Pointer plus generation counter, for building ABA-safe lock-free structures with Atomic.
+// Bump the tag every time the pointer is republished, so that a stale compare-exchange can't
+// succeed just because the same address got recycled.
+template <typename taType>
+struct TaggedPtr
+{
+	bool operator==(const TaggedPtr&) const = default;
+
+	taType* mPtr = nullptr;
+	uint64  mTag = 0;
+};
+
+
+namespace Details
+{
+	void gWaitOnAddress(const void* inAddress, const void* inExpected, int inSize);
+	void gWakeByAddressOne(void* inAddress);
+	void gWakeByAddressAll(void* inAddress);
+}
+
+
+// Futex-style waiting. Block until the atomic's value is different from inExpected.
+// Cheaper than a ConditionVariable when there is no other state to protect: checking is a single
+// atomic load, and waiters only go to the kernel when they actually have to block.
+template <typename taType>
+void gWait(Atomic<taType>& ioAtomic, taType inExpected)
+{
+	// The OS wait can wake spuriously, so loop until an actual change is observed.
+	while (ioAtomic.Load() == inExpected)
+		Details::gWaitOnAddress(&ioAtomic, &inExpected, sizeof(taType));
+}
+
+// Wake one thread blocked in gWait on this atomic.
+template <typename taType>
+void gWakeOne(Atomic<taType>& ioAtomic)
+{
+	Details::gWakeByAddressOne(&ioAtomic);
+}
+
+// Wake all threads blocked in gWait on this atomic.
+template <typename taType>
+void gWakeAll(Atomic<taType>& ioAtomic)
+{
+	Details::gWakeByAddressAll(&ioAtomic);
+}
+
+
 template <typename taType>
 typename Atomic<taType>::ValueType Atomic<taType>::Load(MemoryOrder inOrder) const
 {
 	StorageType value;
 	auto        storage_ptr = (const StorageType*)&mValue;
 
-	if constexpr(sizeof(taType) == 8)
-		value = __iso_volatile_load64(storage_ptr);
-	else if constexpr(sizeof(taType) == 4)
-		value = __iso_volatile_load32((const int*)storage_ptr);
-	else
-		value = __iso_volatile_load8(storage_ptr);
+	if constexpr(sizeof(taType) == 16)
+	{
+		// There is no plain 16 byte atomic load; cmpxchg16b with a zero comparand and exchange
+		// either leaves the value untouched or rewrites zero over zero, and always returns the
+		// current value in the comparand. It is a full barrier, so the order doesn't matter.
+		gAssert(inOrder != MemoryOrder::Release); // Release is not a valid load order.
 
-	switch (inOrder)
+		value = {};
+		_InterlockedCompareExchange128((__int64 volatile*)storage_ptr, 0, 0, (__int64*)&value);
+	}
+	else
 	{
-	case MemoryOrder::Relaxed:	break;
-	case MemoryOrder::SeqCst:	COMPILER_BARRIER(); break;
+		if constexpr(sizeof(taType) == 8)
+			value = __iso_volatile_load64(storage_ptr);
+		else if constexpr(sizeof(taType) == 4)
+			value = __iso_volatile_load32((const int*)storage_ptr);
+		else
+			value = __iso_volatile_load8(storage_ptr);
+
+		switch (inOrder)
+		{
+		case MemoryOrder::Relaxed:	break;
+		case MemoryOrder::Acquire:	COMPILER_BARRIER(); break; // x64 loads have acquire semantics, only need to stop compiler reordering.
+		case MemoryOrder::SeqCst:	COMPILER_BARRIER(); break;
+		case MemoryOrder::Release:	gAssert(false); break; // Release is not a valid load order.
+		}
 	}
 
 	return sAsValue(value);
@@ -115,27 +194,47 @@ void Atomic<taType>::Store(ValueType inValue, MemoryOrder inOrder)
 	StorageType new_value   = sAsStorage(inValue);
 	auto        storage_ptr = (StorageType*)&mValue;
 
-	switch (inOrder)
+	if constexpr(sizeof(taType) == 16)
 	{
-	case MemoryOrder::Relaxed: 
-	{
-		if constexpr(sizeof(taType) == 8)
-			__iso_volatile_store64(storage_ptr, new_value);
-		else if constexpr(sizeof(taType) == 4)
-			__iso_volatile_store32((int*)storage_ptr, new_value);
-		else
-			__iso_volatile_store8(storage_ptr, new_value);
-		break;
+		gAssert(inOrder != MemoryOrder::Acquire); // Acquire is not a valid store order.
+
+		// cmpxchg16b is the only 16 byte atomic instruction; loop until the exchange goes through.
+		// It is a full barrier, so the requested order doesn't matter.
+		StorageType comparand = {};
+		while (_InterlockedCompareExchange128((__int64 volatile*)storage_ptr, new_value.mHigh, new_value.mLow, (__int64*)&comparand) == 0) {}
 	}
-			
-	case MemoryOrder::SeqCst:
-		if constexpr(sizeof(taType) == 8)
-			_InterlockedExchange64(storage_ptr, new_value);
-		else if constexpr(sizeof(taType) == 4)
-			_InterlockedExchange(storage_ptr, new_value);
-		else
-			_InterlockedExchange8(storage_ptr, new_value);
-		break;
+	else
+	{
+		switch (inOrder)
+		{
+		case MemoryOrder::Acquire:
+			gAssert(false); // Acquire is not a valid store order.
+			[[fallthrough]];
+
+		case MemoryOrder::Release:
+			COMPILER_BARRIER(); // x64 stores have release semantics, only need to stop compiler reordering.
+			[[fallthrough]];
+
+		case MemoryOrder::Relaxed:
+		{
+			if constexpr(sizeof(taType) == 8)
+				__iso_volatile_store64(storage_ptr, new_value);
+			else if constexpr(sizeof(taType) == 4)
+				__iso_volatile_store32((int*)storage_ptr, new_value);
+			else
+				__iso_volatile_store8(storage_ptr, new_value);
+			break;
+		}
+
+		case MemoryOrder::SeqCst:
+			if constexpr(sizeof(taType) == 8)
+				_InterlockedExchange64(storage_ptr, new_value);
+			else if constexpr(sizeof(taType) == 4)
+				_InterlockedExchange(storage_ptr, new_value);
+			else
+				_InterlockedExchange8(storage_ptr, new_value);
+			break;
+		}
 	}
 }
 
@@ -147,7 +246,13 @@ typename Atomic<taType>::ValueType Atomic<taType>::Exchange(ValueType inValue, M
 	auto        storage_ptr = (StorageType*)&mValue;
 	StorageType previous_value;
 
-	if constexpr(sizeof(taType) == 8)
+	if constexpr(sizeof(taType) == 16)
+	{
+		// The comparand is updated with the current value on failure, so the loop converges.
+		previous_value = {};
+		while (_InterlockedCompareExchange128((__int64 volatile*)storage_ptr, new_value.mHigh, new_value.mLow, (__int64*)&previous_value) == 0) {}
+	}
+	else if constexpr(sizeof(taType) == 8)
 		previous_value = _InterlockedExchange64(storage_ptr, new_value);
 	else if constexpr(sizeof(taType) == 4)
 		previous_value = _InterlockedExchange(storage_ptr, new_value);
@@ -166,7 +271,13 @@ bool Atomic<taType>::CompareExchange(ValueType& ioExpected, ValueType inDesired)
 	auto        storage_ptr = (StorageType*)&mValue;
 	StorageType previous_value;
 
-	if constexpr(sizeof(taType) == 8)
+	if constexpr(sizeof(taType) == 16)
+	{
+		// cmpxchg16b updates the comparand with the current value, which is exactly what we need.
+		previous_value = expected;
+		_InterlockedCompareExchange128((__int64 volatile*)storage_ptr, desired.mHigh, desired.mLow, (__int64*)&previous_value);
+	}
+	else if constexpr(sizeof(taType) == 8)
 		previous_value = _InterlockedCompareExchange64(storage_ptr, desired, expected);
 	else if constexpr(sizeof(taType) == 4)
 		previous_value = _InterlockedCompareExchange(storage_ptr, desired, expected);
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/Benchmark.h>
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/Trace.h>
+#include <Bedrock/Vector.h>
+
+
+struct BenchmarkEntry
+{
+	const char*       mName;
+	BenchmarkFunction mFunction = nullptr;
+};
+
+static Vector<BenchmarkEntry>& sGetAllBenchmarks()
+{
+	// Return a static variable to avoid issues with globals initialization order.
+	static Vector<BenchmarkEntry> sAllBenchmarks;
+	return sAllBenchmarks;
+}
+
+
+void gRegisterBenchmark(const char* inName, BenchmarkFunction inFunction)
+{
+	gAssert(inName != nullptr && inName[0] != 0);
+
+	sGetAllBenchmarks().PushBack({ inName, inFunction });
+}
+
+
+struct BenchmarkInternal
+{
+	// Run a benchmark once for inNumIterations and return the elapsed nanoseconds.
+	static int64 sRunOnce(const BenchmarkEntry& inEntry, int64 inNumIterations, int64& outItemsPerIteration)
+	{
+		Benchmark benchmark;
+		benchmark.mTotalIterations     = inNumIterations;
+		benchmark.mRemainingIterations = inNumIterations;
+
+		inEntry.mFunction(benchmark);
+
+		outItemsPerIteration = benchmark.mItemsPerIteration;
+		return gTicksToNanoseconds(benchmark.mElapsedTicks);
+	}
+};
+
+
+void gRunBenchmarks()
+{
+	gTrace("Running all benchmarks.");
+
+	// Each measured run should take at least this long, to dwarf the timer resolution.
+	constexpr int64 cMinRunTimeNS   = 10'000'000; // 10ms
+	constexpr int   cNumRepetitions = 7;
+
+	for (const BenchmarkEntry& entry : sGetAllBenchmarks())
+	{
+		int64 items_per_iteration = 1;
+
+		// Warmup, and find how many iterations are needed to reach the min run time.
+		int64 iterations = 1;
+		while (true)
+		{
+			int64 elapsed_ns = BenchmarkInternal::sRunOnce(entry, iterations, items_per_iteration);
+
+			if (elapsed_ns >= cMinRunTimeNS)
+				break;
+
+			// Grow towards the target, at most 10x at a time since short runs estimate poorly.
+			int64 multiplier = (elapsed_ns > 0) ? gClamp(cMinRunTimeNS / elapsed_ns, (int64)2, (int64)10) : 10;
+			iterations *= multiplier;
+		}
+
+		// Measure several repetitions.
+		int64 repetitions_ns[cNumRepetitions];
+		for (int64& rep_ns : repetitions_ns)
+			rep_ns = BenchmarkInternal::sRunOnce(entry, iterations, items_per_iteration);
+
+		// The fastest repetition is the least disturbed by the OS/other processes; the median
+		// shows how noisy the measurement was. Slow outliers get ignored entirely.
+		gSort(repetitions_ns, repetitions_ns + cNumRepetitions);
+		double best_ns_per_op   = (double)repetitions_ns[0] / (double)iterations;
+		double median_ns_per_op = (double)repetitions_ns[cNumRepetitions / 2] / (double)iterations;
+
+		if (items_per_iteration > 1)
+		{
+			double items_per_sec = (double)items_per_iteration * 1.0e9 / best_ns_per_op;
+			gTrace(R"(Benchmark "%s": %.2f ns/op best, %.2f ns/op median, %.2f M items/sec (%lld iterations x %d))",
+				entry.mName, best_ns_per_op, median_ns_per_op, items_per_sec / 1.0e6, iterations, cNumRepetitions);
+		}
+		else
+		{
+			gTrace(R"(Benchmark "%s": %.2f ns/op best, %.2f ns/op median (%lld iterations x %d))",
+				entry.mName, best_ns_per_op, median_ns_per_op, iterations, cNumRepetitions);
+		}
+	}
+}
+
+
+REGISTER_BENCHMARK("Loop Overhead")
+{
+	// Measures the cost of the Loop() bookkeeping itself; useful as a baseline for other results.
+	while (ioBenchmark.Loop())
+	{
+		int value = 0;
+		gDoNotOptimize(value);
+	}
+};
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Atomic.h> // For COMPILER_BARRIER.
+#include <Bedrock/Ticks.h>
+
+struct Benchmark;
+
+using BenchmarkFunction = void (*)(Benchmark&);
+
+// Register a benchmark. Called automatically by REGISTER_BENCHMARK.
+void gRegisterBenchmark(const char* inName, BenchmarkFunction inFunction);
+
+// Run all registered benchmarks and trace the results.
+// Unlike tests, benchmarks are registered in all configs; only measuring optimized builds makes sense though.
+void gRunBenchmarks();
+
+
+// The state of one benchmark run. The runner decides how many iterations to measure;
+// the benchmark function just loops until Loop() returns false.
+struct Benchmark : NoCopy
+{
+	// The measured loop. Timing starts on the first call and stops when it returns false.
+	// eg.
+	//
+	// REGISTER_BENCHMARK("Additions")
+	// {
+	//		while (ioBenchmark.Loop())
+	//			gDoNotOptimize(some_value += 1);
+	// };
+	force_inline bool Loop()
+	{
+		if (mRemainingIterations == mTotalIterations) [[unlikely]]
+			mStartTicks = gGetTickCount();
+
+		if (mRemainingIterations-- > 0) [[likely]]
+			return true;
+
+		mElapsedTicks = gGetTickCount() - mStartTicks;
+		return false;
+	}
+
+	// Tell the runner how many items one iteration processes (1 by default), for the items/sec report.
+	// eg. the number of elements looked up per iteration in a container benchmark.
+	void SetItemsPerIteration(int64 inNumItems) { mItemsPerIteration = inNumItems; }
+
+private:
+	friend struct BenchmarkInternal;
+
+	int64 mTotalIterations     = 0;
+	int64 mRemainingIterations = 0;
+	int64 mStartTicks          = 0;
+	int64 mElapsedTicks        = 0;
+	int64 mItemsPerIteration   = 1;
+};
+
+
+// Make sure the compiler doesn't optimize away a value (and the computation producing it).
+template <typename taType>
+force_inline void gDoNotOptimize(taType&& ioValue)
+{
+#ifdef __clang__
+	asm volatile("" : "+r,m"(ioValue) : : "memory");
+#elif _MSC_VER
+	// Forcing a volatile read of the value is the best MSVC equivalent.
+	[[maybe_unused]] char volatile unused = *(char volatile*)&ioValue;
+	COMPILER_BARRIER();
+#else
+#error Unknown compiler
+#endif
+}
+
+
+namespace Details
+{
+	struct BenchmarkDummy
+	{
+		const char* mName;
+		consteval BenchmarkDummy(const char* inName)
+		{
+			gAssert(inName != nullptr && inName[0] != 0);
+			mName = inName;
+		}
+	};
+
+	struct BenchmarkRegisterer { BenchmarkRegisterer(const char* inName, BenchmarkFunction inFunction) { gRegisterBenchmark(inName, inFunction); } };
+	inline BenchmarkRegisterer operator*(BenchmarkDummy inDummy, BenchmarkFunction inFunction) { return { inDummy.mName, inFunction }; }
+}
+
+// Register a benchmark.
+// eg.
+//
+// REGISTER_BENCHMARK("Vector PushBack")
+// {
+//		while (ioBenchmark.Loop())
+//		{
+//			Vector<int> vec;
+//			for (int i = 0; i < 100; i++)
+//				vec.PushBack(i);
+//			gDoNotOptimize(vec);
+//		}
+//		ioBenchmark.SetItemsPerIteration(100);
+// };
+#define REGISTER_BENCHMARK(name) static auto TOKEN_PASTE(benchmark_register, __LINE__) = Details::BenchmarkDummy{ name } *[](Benchmark& ioBenchmark)
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/BitVector.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("BitVector")
+{
+	BitVector bits;
+	TEST_TRUE(bits.Empty());
+	TEST_TRUE(bits.FindFirstSet() == -1);
+	TEST_TRUE(bits.CountSetBits() == 0);
+
+	bits.Resize(200);
+	TEST_TRUE(bits.Size() == 200);
+	TEST_TRUE(bits.CountSetBits() == 0);
+
+	bits.Set(0);
+	bits.Set(63);
+	bits.Set(64);
+	bits.Set(199);
+	TEST_TRUE(bits[0] && bits[63] && bits[64] && bits[199]);
+	TEST_FALSE(bits[1]);
+	TEST_TRUE(bits.CountSetBits() == 4);
+
+	TEST_TRUE(bits.FindFirstSet() == 0);
+	TEST_TRUE(bits.FindFirstSet(1) == 63);
+	TEST_TRUE(bits.FindFirstSet(64) == 64);
+	TEST_TRUE(bits.FindFirstSet(65) == 199);
+	TEST_TRUE(bits.FindFirstSet(200) == -1);
+
+	bits.Clear(63);
+	TEST_FALSE(bits[63]);
+	TEST_TRUE(bits.FindFirstSet(1) == 64);
+
+	// Iteration visits the set bits in increasing order.
+	Vector<int> set_bits;
+	bits.ForEachSetBit([&set_bits](int inBit) { set_bits.PushBack(inBit); });
+	Vector<int> expected_bits = { 0, 64, 199 };
+	TEST_TRUE(Span(set_bits) == Span(expected_bits));
+
+	// Ranges spanning multiple words, including partial first/last words.
+	bits.ClearAll();
+	bits.SetRange(10, 150);
+	TEST_TRUE(bits.CountSetBits() == 140);
+	TEST_FALSE(bits[9]);
+	TEST_TRUE(bits[10] && bits[149]);
+	TEST_FALSE(bits[150]);
+
+	bits.ClearRange(60, 70);
+	TEST_TRUE(bits.CountSetBits() == 130);
+	TEST_TRUE(bits[59]);
+	TEST_FALSE(bits[60] || bits[69]);
+	TEST_TRUE(bits[70]);
+
+	// Range inside a single word.
+	bits.ClearAll();
+	bits.SetRange(5, 9);
+	TEST_TRUE(bits.CountSetBits() == 4);
+	TEST_TRUE(bits.FindFirstSet() == 5);
+
+	// SetAll doesn't touch the bits past the size (CountSetBits would see them).
+	bits.SetAll();
+	TEST_TRUE(bits.CountSetBits() == 200);
+
+	// Shrinking then growing clears the previously set bits.
+	bits.Resize(100);
+	TEST_TRUE(bits.CountSetBits() == 100);
+	bits.Resize(200);
+	TEST_TRUE(bits.CountSetBits() == 100);
+	TEST_TRUE(bits.FindFirstSet(100) == -1);
+
+	// FixedBitVector stores everything in the object itself (no allocation).
+	FixedBitVector<128> fixed_bits;
+	fixed_bits.Resize(128);
+	fixed_bits.Set(127);
+	TEST_TRUE(fixed_bits.FindFirstSet() == 127);
+};
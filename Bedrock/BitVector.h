@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Allocator.h>
+#include <Bedrock/Vector.h>
+
+
+// Dynamic bit array. One bit per element (8x smaller than a Vector of bools), stored in 64-bit words.
+// The word granularity is what makes the bulk operations fast: SetRange/ClearRange touch whole words,
+// CountSetBits is a popcount per word, and FindFirstSet/ForEachSetBit skip empty words and use
+// trailing-zero scans inside non-empty ones.
+// Note: The unused high bits of the last word are always kept at zero, methods rely on it.
+template <typename taAllocator = DefaultAllocator<uint64>>
+struct BitVector
+{
+	static constexpr int cBitsPerWord = 64;
+
+	// Default
+	BitVector() = default;
+	~BitVector() = default;
+
+	// Default with Allocator
+	explicit BitVector(taAllocator&& inAllocator) : mWords(gMove(inAllocator)) {}
+
+	// Move
+	BitVector(BitVector&&) = default;
+	BitVector& operator=(BitVector&&) = default;
+
+	// Copy
+	BitVector(const BitVector&) = default;
+	BitVector& operator=(const BitVector&) = default;
+
+	int Size() const { return mNumBits; }
+	bool Empty() const { return mNumBits == 0; }
+
+	void Reserve(int inNumBits) { mWords.Reserve(sGetNumWords(inNumBits)); }
+
+	// Resize the bit array. New bits are cleared.
+	void Resize(int inNumBits)
+	{
+		gAssert(inNumBits >= 0);
+
+		mWords.Resize(sGetNumWords(inNumBits));
+		mNumBits = inNumBits;
+
+		// Clear the unused bits of the last word (in case this shrank below set bits).
+		ClearTrailingBits();
+	}
+
+	bool IsSet(int inBit) const
+	{
+		gBoundsCheck(inBit, mNumBits);
+		return (mWords[inBit / cBitsPerWord] >> (inBit % cBitsPerWord)) & 1;
+	}
+
+	bool operator[](int inBit) const { return IsSet(inBit); }
+
+	void Set(int inBit, bool inValue = true)
+	{
+		gBoundsCheck(inBit, mNumBits);
+
+		if (inValue)
+			mWords[inBit / cBitsPerWord] |= (uint64)1 << (inBit % cBitsPerWord);
+		else
+			mWords[inBit / cBitsPerWord] &= ~((uint64)1 << (inBit % cBitsPerWord));
+	}
+
+	void Clear(int inBit) { Set(inBit, false); }
+
+	// Set all the bits in [inBegin, inEnd).
+	void SetRange(int inBegin, int inEnd)
+	{
+		if (inBegin >= inEnd)
+			return;
+
+		gBoundsCheck(inBegin, mNumBits);
+		gBoundsCheck(inEnd - 1, mNumBits);
+
+		int    first_word = inBegin / cBitsPerWord;
+		int    last_word  = (inEnd - 1) / cBitsPerWord;
+		uint64 first_mask = cAllBits << (inBegin % cBitsPerWord);
+		uint64 last_mask  = cAllBits >> (cBitsPerWord - 1 - ((inEnd - 1) % cBitsPerWord));
+
+		if (first_word == last_word)
+		{
+			mWords[first_word] |= (first_mask & last_mask);
+			return;
+		}
+
+		mWords[first_word] |= first_mask;
+
+		for (int word = first_word + 1; word < last_word; word++)
+			mWords[word] = cAllBits;
+
+		mWords[last_word] |= last_mask;
+	}
+
+	// Clear all the bits in [inBegin, inEnd).
+	void ClearRange(int inBegin, int inEnd)
+	{
+		if (inBegin >= inEnd)
+			return;
+
+		gBoundsCheck(inBegin, mNumBits);
+		gBoundsCheck(inEnd - 1, mNumBits);
+
+		int    first_word = inBegin / cBitsPerWord;
+		int    last_word  = (inEnd - 1) / cBitsPerWord;
+		uint64 first_mask = cAllBits << (inBegin % cBitsPerWord);
+		uint64 last_mask  = cAllBits >> (cBitsPerWord - 1 - ((inEnd - 1) % cBitsPerWord));
+
+		if (first_word == last_word)
+		{
+			mWords[first_word] &= ~(first_mask & last_mask);
+			return;
+		}
+
+		mWords[first_word] &= ~first_mask;
+
+		for (int word = first_word + 1; word < last_word; word++)
+			mWords[word] = 0;
+
+		mWords[last_word] &= ~last_mask;
+	}
+
+	void SetAll()
+	{
+		for (uint64& word : mWords)
+			word = cAllBits;
+
+		ClearTrailingBits();
+	}
+
+	void ClearAll()
+	{
+		for (uint64& word : mWords)
+			word = 0;
+	}
+
+	// Return the number of set bits.
+	int CountSetBits() const
+	{
+		int count = 0;
+		for (uint64 word : mWords)
+			count += gCountSetBits64(word);
+
+		return count;
+	}
+
+	// Return the index of the first set bit at or after inStartBit, or -1 if there is none.
+	int FindFirstSet(int inStartBit = 0) const
+	{
+		if (inStartBit >= mNumBits)
+			return -1;
+
+		gAssert(inStartBit >= 0);
+
+		int    word_index = inStartBit / cBitsPerWord;
+		uint64 word       = mWords[word_index] & (cAllBits << (inStartBit % cBitsPerWord));
+
+		while (true)
+		{
+			if (word != 0)
+				return word_index * cBitsPerWord + gCountTrailingZeros64(word);
+
+			word_index++;
+			if (word_index == mWords.Size())
+				return -1;
+
+			word = mWords[word_index];
+		}
+	}
+
+	// Call ioFunc(int inBit) for every set bit, in increasing order.
+	template <typename taFunc>
+	void ForEachSetBit(taFunc&& ioFunc) const
+	{
+		for (int word_index = 0, num_words = mWords.Size(); word_index < num_words; word_index++)
+		{
+			uint64 word = mWords[word_index];
+
+			while (word != 0)
+			{
+				ioFunc(word_index * cBitsPerWord + gCountTrailingZeros64(word));
+				word &= word - 1; // Clear the lowest set bit.
+			}
+		}
+	}
+
+private:
+	static constexpr uint64 cAllBits = (uint64)-1;
+
+	static int sGetNumWords(int inNumBits) { return (inNumBits + cBitsPerWord - 1) / cBitsPerWord; }
+
+	// Clear the unused bits of the last word (they have to stay zero for CountSetBits/FindFirstSet).
+	void ClearTrailingBits()
+	{
+		int used_bits_in_last_word = mNumBits % cBitsPerWord;
+		if (used_bits_in_last_word != 0)
+			mWords.Back() &= cAllBits >> (cBitsPerWord - used_bits_in_last_word);
+	}
+
+	Vector<uint64, taAllocator> mWords;
+	int                         mNumBits = 0;
+};
+
+
+// Alias for a BitVector using the TempAllocator.
+using TempBitVector = BitVector<TempAllocator<uint64>>;
+
+// Alias for a BitVector using the ArenaAllocator.
+// A MemArena needs to be passed to the BitVector before it can be used.
+using ArenaBitVector = BitVector<ArenaAllocator<uint64>>;
+
+// Alias for a BitVector using the VMemAllocator, for very large bit arrays.
+using VMemBitVector = BitVector<VMemAllocator<uint64>>;
+
+// Alias for a BitVector using a FixedAllocator.
+// It contains a fixed size buffer large enough to store taSize bits.
+template <int taSize>
+using FixedBitVector = BitVector<FixedAllocator<uint64, (taSize + 63) / 64>>;
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/ConcurrentHashMap.h>
+
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
+
+
+REGISTER_TEST("ConcurrentHashMap")
+{
+	ConcurrentHashMap<uint32, int> map;
+
+	// Single-threaded basics first.
+	TEST_TRUE(map.Insert(1, 100) == EInsertResult::Added);
+	TEST_TRUE(map.Insert(1, 200) == EInsertResult::Found); // Insert doesn't replace.
+
+	int value = 0;
+	TEST_TRUE(map.Find(1, value));
+	TEST_TRUE(value == 100);
+
+	TEST_TRUE(map.InsertOrAssign(1, 200) == EInsertResult::Replaced);
+	TEST_TRUE(map.Find(1, value));
+	TEST_TRUE(value == 200);
+
+	TEST_FALSE(map.Find(2, value));
+	TEST_FALSE(map.Contains(2));
+
+	TEST_TRUE(map.Erase(1));
+	TEST_FALSE(map.Erase(1));
+	TEST_TRUE(map.Size() == 0);
+
+	// Spread keys over every shard and check ForEach sees them all exactly once.
+	constexpr int cNumKeys = 1000;
+	map.Reserve(cNumKeys);
+	for (uint32 i = 0; i < cNumKeys; i++)
+		map.Insert(i, (int)i * 2);
+	TEST_TRUE(map.Size() == cNumKeys);
+
+	int  num_visited = 0;
+	bool all_correct = true;
+	map.ForEach([&num_visited, &all_correct](const KeyValue<uint32, int>& inKeyValue) {
+		num_visited++;
+		all_correct = all_correct && (inKeyValue.mValue == (int)inKeyValue.mKey * 2);
+	});
+	TEST_TRUE(num_visited == cNumKeys);
+	TEST_TRUE(all_correct);
+
+	map.Clear();
+	TEST_TRUE(map.Size() == 0);
+};
+
+
+REGISTER_TEST("ConcurrentHashMap Threads")
+{
+	ConcurrentHashMap<uint32, int> map;
+
+	// Several threads insert disjoint key ranges while others read, all at the same time.
+	constexpr int cNumWriters      = 4;
+	constexpr int cNumReaders      = 4;
+	constexpr int cKeysPerWriter   = 10000;
+
+	AtomicInt32 num_found = 0;
+
+	Thread writers[cNumWriters];
+	Thread readers[cNumReaders];
+
+	for (int t = 0; t < cNumWriters; t++)
+	{
+		writers[t].Create({ .mName = "Writer", .mTempMemSize = 0 }, [&map, t](Thread&) {
+			for (int i = 0; i < cKeysPerWriter; i++)
+				map.Insert((uint32)(t * cKeysPerWriter + i), t);
+		});
+	}
+
+	for (int t = 0; t < cNumReaders; t++)
+	{
+		readers[t].Create({ .mName = "Reader", .mTempMemSize = 0 }, [&map, &num_found](Thread&) {
+			// Look for keys while the writers are still going; count the ones already visible.
+			int found = 0;
+			for (int i = 0; i < cNumWriters * cKeysPerWriter; i++)
+			{
+				int value;
+				if (map.Find((uint32)i, value))
+					found++;
+			}
+			num_found.Add(found);
+		});
+	}
+
+	for (Thread& writer : writers)
+		writer.Join();
+	for (Thread& reader : readers)
+		reader.Join();
+
+	// Every insert is visible once the writers joined, and the values identify their writer.
+	TEST_TRUE(map.Size() == cNumWriters * cKeysPerWriter);
+	for (int t = 0; t < cNumWriters; t++)
+		for (int i = 0; i < cKeysPerWriter; i += 100)
+		{
+			int value = -1;
+			TEST_TRUE(map.Find((uint32)(t * cKeysPerWriter + i), value));
+			TEST_TRUE(value == t);
+		}
+
+	TEST_TRUE(num_found.Load() >= 0); // The readers just must not have crashed or deadlocked.
+};
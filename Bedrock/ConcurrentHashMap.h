@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/HashMap.h>
+#include <Bedrock/Mutex.h>
+
+
+// Sharded concurrent hash map.
+// The key space is split across taNumShards independent HashMaps selected by the high hash bits
+// (the maps use the low bits for their buckets), each behind its own SharedMutex on its own cache
+// line. Readers take one shared lock, writers one exclusive lock, so threads only contend when
+// they hit the same shard: read scaling is near-linear instead of ending at a single map mutex.
+// Iterators can't outlive the shard lock, so Find copies the value out instead of returning one,
+// and ForEach visits the elements while locking one shard at a time.
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>,
+	int taNumShards = 64,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+struct ConcurrentHashMap : private taHash
+{
+	static_assert(gIsPow2(taNumShards));
+
+	using ShardMap = HashMap<taKey, taValue, taHash, taAllocator>;
+	using KeyValue = typename ShardMap::KeyValue;
+
+	ConcurrentHashMap() = default;
+	~ConcurrentHashMap() = default;
+
+	// Not movable: other threads may hold references to the shards.
+	ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+	ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+	// Find a key and copy its value out. Returns false if the key isn't in the map.
+	bool Find(const taKey& inKey, taValue& outValue) const
+	{
+		const Shard&    shard = GetShard(inKey);
+		SharedLockGuard lock(shard.mMutex);
+
+		auto iter = shard.mMap.Find(inKey);
+		if (iter == shard.mMap.End())
+			return false;
+
+		outValue = iter->mValue;
+		return true;
+	}
+
+	bool Contains(const taKey& inKey) const
+	{
+		const Shard&    shard = GetShard(inKey);
+		SharedLockGuard lock(shard.mMutex);
+
+		return shard.mMap.Contains(inKey);
+	}
+
+	// Insert a key-value. Does not replace the value if the key already exists.
+	EInsertResult Insert(const taKey& inKey, const taValue& inValue)
+	{
+		Shard&    shard = GetShard(inKey);
+		LockGuard lock(shard.mMutex);
+
+		return shard.mMap.Insert(inKey, inValue).mResult;
+	}
+
+	// Insert a key-value, replacing the value if the key already exists.
+	EInsertResult InsertOrAssign(const taKey& inKey, const taValue& inValue)
+	{
+		Shard&    shard = GetShard(inKey);
+		LockGuard lock(shard.mMutex);
+
+		return shard.mMap.InsertOrAssign(inKey, inValue).mResult;
+	}
+
+	// Erase a key. Returns true if it was erased, false if it wasn't in the map.
+	bool Erase(const taKey& inKey)
+	{
+		Shard&    shard = GetShard(inKey);
+		LockGuard lock(shard.mMutex);
+
+		return shard.mMap.Erase(inKey);
+	}
+
+	// Visit every key-value, locking one shard at a time (shared).
+	// Concurrent writers can modify other shards in the meantime; don't touch the map from inFunc.
+	template <typename taFunc>
+	void ForEach(taFunc&& inFunc) const
+	{
+		for (const Shard& shard : mShards)
+		{
+			SharedLockGuard lock(shard.mMutex);
+
+			for (const KeyValue& key_value : shard.mMap)
+				inFunc(key_value);
+		}
+	}
+
+	// Number of elements. Only exact if no other thread is inserting/erasing.
+	int Size() const
+	{
+		int size = 0;
+		for (const Shard& shard : mShards)
+		{
+			SharedLockGuard lock(shard.mMutex);
+			size += shard.mMap.Size();
+		}
+		return size;
+	}
+
+	void Clear()
+	{
+		for (Shard& shard : mShards)
+		{
+			LockGuard lock(shard.mMutex);
+			shard.mMap.Clear();
+		}
+	}
+
+	// Reserve capacity for inCapacity elements, spread evenly across the shards.
+	void Reserve(int inCapacity)
+	{
+		int per_shard = (inCapacity + taNumShards - 1) / taNumShards;
+		for (Shard& shard : mShards)
+		{
+			LockGuard lock(shard.mMutex);
+			shard.mMap.Reserve(per_shard);
+		}
+	}
+
+private:
+	// Each shard on its own cache line(s) so the locks don't false-share.
+	struct alignas(64) Shard
+	{
+		mutable SharedMutex mMutex;
+		ShardMap            mMap;
+	};
+
+	static constexpr int cShardBits = []() { int bits = 0; while ((1 << bits) < taNumShards) bits++; return bits; }();
+
+	// Shards are selected by the high hash bits; the maps use the low bits for their buckets.
+	int GetShardIndex(const taKey& inKey) const
+	{
+		if constexpr (cShardBits == 0)
+			return 0;
+		else
+			return (int)(taHash::operator()(inKey) >> (64 - cShardBits));
+	}
+
+	Shard&       GetShard(const taKey& inKey)       { return mShards[GetShardIndex(inKey)]; }
+	const Shard& GetShard(const taKey& inKey) const { return mShards[GetShardIndex(inKey)]; }
+
+	Shard mShards[taNumShards];
+};
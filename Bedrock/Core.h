@@ -114,6 +114,9 @@ constexpr int64 gAlignDown(int64 inValue, int64 inPow2Alignment)	{ return inValu
 
 #ifdef _MSC_VER
 extern "C" unsigned char _BitScanReverse64(unsigned long* _Index, unsigned __int64 _Mask);
+extern "C" unsigned char _BitScanForward(unsigned long* _Index, unsigned long _Mask);
+extern "C" unsigned char _BitScanForward64(unsigned long* _Index, unsigned __int64 _Mask);
+extern "C" unsigned __int64 __popcnt64(unsigned __int64 _Value);
 #endif
 
 inline int gCountLeadingZeros64(uint64 inValue)
@@ -130,6 +133,45 @@ inline int gCountLeadingZeros64(uint64 inValue)
 #endif
 }
 
+inline int gCountTrailingZeros32(uint32 inValue)
+{
+	gAssert(inValue != 0);
+#ifdef __clang__
+	return __builtin_ctz(inValue);
+#elif _MSC_VER
+	uint32 index;
+	_BitScanForward(&index, inValue);
+	return (int)index;
+#else
+#error Unknown compiler
+#endif
+}
+
+inline int gCountTrailingZeros64(uint64 inValue)
+{
+	gAssert(inValue != 0);
+#ifdef __clang__
+	return __builtin_ctzll(inValue);
+#elif _MSC_VER
+	uint32 index;
+	_BitScanForward64(&index, inValue);
+	return (int)index;
+#else
+#error Unknown compiler
+#endif
+}
+
+inline int gCountSetBits64(uint64 inValue)
+{
+#ifdef __clang__
+	return __builtin_popcountll(inValue);
+#elif _MSC_VER
+	return (int)__popcnt64(inValue);
+#else
+#error Unknown compiler
+#endif
+}
+
 inline int64 gGetNextPow2(int64 inValue)
 {
 	if (inValue <= 1) [[unlikely]]
@@ -138,12 +180,33 @@ inline int64 gGetNextPow2(int64 inValue)
 }
 
 
+// Prefetch the cache line containing inPtr into the cache hierarchy.
+// Useful to hide the latency of cache misses when future accesses are known in advance.
+#if defined(_MSC_VER) && !defined(__clang__)
+extern "C" void _mm_prefetch(const char* _A, int _Sel);
+#pragma intrinsic(_mm_prefetch)
+#endif
+
+force_inline void gPrefetch(const void* inPtr)
+{
+#ifdef __clang__
+	__builtin_prefetch(inPtr);
+#elif _MSC_VER
+	_mm_prefetch((const char*)inPtr, 1); // 1 = _MM_HINT_T0
+#else
+#error Unknown compiler
+#endif
+}
+
+
 // Some useful C std function replacements to avoid an include or because the real ones aren't constexpr.
 force_inline constexpr int gStrLen(const char* inString)								{ return (int)__builtin_strlen(inString); }
 force_inline constexpr int gMemCmp(const void* inPtrA, const void* inPtrB, int inSize)	{ return __builtin_memcmp(inPtrA, inPtrB, inSize); }
 extern "C" void* __cdecl   memcpy(void* inDest, void const* inSource, size_t inSize);
 extern "C" void* __cdecl   memmove(void* inDest, void const* inSource, size_t inSize);
+extern "C" void* __cdecl   memset(void* inDest, int inValue, size_t inSize);
 force_inline void		   gMemCopy(void* inDest, const void* inSource, int inSize)		{ memcpy(inDest, inSource, inSize); }
 force_inline void		   gMemMove(void* inDest, const void* inSource, int inSize)		{ memmove(inDest, inSource, inSize); }
+force_inline void		   gMemSet(void* inDest, uint8 inValue, int inSize)				{ memset(inDest, inValue, inSize); }
 
 
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/StringView.h>
+
+
+// How a MappedFile maps its contents.
+enum class EMappedFileAccess
+{
+	ReadOnly,    // Writing to the mapped memory is an access violation.
+	CopyOnWrite, // Writing is allowed; written pages become private copies, the file itself is never modified.
+};
+
+
+// Expected access pattern, the equivalent of madvise. Tells the OS how to read ahead.
+enum class EMappedFileHint
+{
+	Normal,     // No particular pattern.
+	Sequential, // The file is read front to back; read ahead aggressively.
+	Random,     // Accesses are scattered; don't bother reading ahead.
+};
+
+
+// Read-only (or copy-on-write) memory-mapped file.
+// The contents are exposed as a Span/StringView pointing directly at the mapped pages, so reading
+// large files costs no copy and no committed memory beyond the pages actually touched (unlike
+// read()-style buffering, which copies everything through the file cache into a heap buffer).
+struct MappedFile : NoCopy
+{
+	MappedFile() = default;
+	~MappedFile() { Close(); }
+
+	// Move
+	MappedFile(MappedFile&& ioOther) { MoveFrom((MappedFile&&)ioOther); }
+	MappedFile& operator=(MappedFile&& ioOther) { MoveFrom((MappedFile&&)ioOther); return *this; }
+
+	// Open and map an existing file. Returns false if it doesn't exist or can't be mapped.
+	// An empty file opens successfully with a zero-sized view.
+	bool Open(StringView inPath, EMappedFileAccess inAccess = EMappedFileAccess::ReadOnly, EMappedFileHint inHint = EMappedFileHint::Normal);
+
+	// Unmap and close the file. The views are invalid after this.
+	void Close();
+
+	bool IsOpen() const { return mFile != nullptr; }
+
+	int64 GetSize() const { return mSize; }
+
+	// Get the file contents. Valid until Close.
+	Span<const uint8> GetBytes() const { gAssert(mSize <= cMaxInt); return { mData, (int)mSize }; }
+	StringView        GetText() const  { gAssert(mSize <= cMaxInt); return { (const char*)mData, (int)mSize }; }
+
+	// Get the file contents as writable memory. Copy-on-write mappings only.
+	Span<uint8> GetMutableBytes() { gAssert(mAccess == EMappedFileAccess::CopyOnWrite && mSize <= cMaxInt); return { mData, (int)mSize }; }
+
+	// Ask the OS to page in the whole mapping now (without blocking on the result).
+	// Useful before a sequential parse of a cold file.
+	void Prefetch() const;
+
+private:
+	void MoveFrom(MappedFile&& ioOther);
+
+	void*             mFile    = nullptr; // Win32 file handle.
+	void*             mMapping = nullptr; // Win32 file mapping handle.
+	uint8*            mData    = nullptr;
+	int64             mSize    = 0;
+	EMappedFileAccess mAccess  = EMappedFileAccess::ReadOnly;
+};
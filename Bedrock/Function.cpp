@@ -53,3 +53,55 @@ REGISTER_TEST("Function")
 	func2(1);
 };
 
+
+REGISTER_TEST("Function Storage Size")
+{
+	// Captures too large for the default storage fit if the size parameter is bumped.
+	uint64 values[6] = { 1, 2, 3, 4, 5, 6 };
+
+	Function<uint64(), 64> func = [values]() {
+		uint64 sum = 0;
+		for (uint64 value : values)
+			sum += value;
+		return sum;
+	};
+	static_assert(sizeof(values) > cDefaultFunctionStorageSize);
+
+	TEST_TRUE(func() == 21);
+
+	// Moving still works between same-size Functions.
+	Function<uint64(), 64> func2 = gMove(func);
+	TEST_FALSE(func.IsValid());
+	TEST_TRUE(func2() == 21);
+};
+
+
+REGISTER_TEST("FunctionRef")
+{
+	// FunctionRef points at the callable instead of storing it, so there is no size limit.
+	uint64 values[6] = { 1, 2, 3, 4, 5, 6 };
+
+	auto sum_lambda = [&values](uint64 inExtra) {
+		uint64 sum = inExtra;
+		for (uint64 value : values)
+			sum += value;
+		return sum;
+	};
+
+	FunctionRef<uint64(uint64)> func_ref = sum_lambda;
+	TEST_TRUE(func_ref.IsValid());
+	TEST_TRUE(func_ref(100) == 121);
+
+	// Copying is fine, both refs point at the same callable.
+	FunctionRef<uint64(uint64)> func_ref2 = func_ref;
+	values[0] = 11;
+	TEST_TRUE(func_ref(0) == func_ref2(0));
+	TEST_TRUE(func_ref(0) == 31);
+
+	// A Function can be passed where a FunctionRef is expected.
+	Function<uint64(uint64)> func = [](uint64 inValue) { return inValue * 2; };
+	FunctionRef<uint64(uint64)> func_ref3 = func;
+	TEST_TRUE(func_ref3(21) == 42);
+
+	TEST_FALSE(FunctionRef<void()>().IsValid());
+};
@@ -5,15 +5,25 @@
 #include <Bedrock/PlacementNew.h>
 #include <Bedrock/Move.h>
 
-template <typename taType> struct Function;
+// Default inline storage size. Bumping the second template parameter (eg. Function<void(), 64>)
+// allows larger captures; there is no heap fallback, a lambda that doesn't fit fails to compile.
+constexpr int cDefaultFunctionStorageSize = sizeof(void*) * 4;
+
+template <typename taType, int taStorageSize = cDefaultFunctionStorageSize> struct Function;
+
+namespace Details
+{
+	template <typename taType> constexpr bool cIsFunction = false;
+	template <typename taType, int taStorageSize> constexpr bool cIsFunction<Function<taType, taStorageSize>> = true;
+}
 
 
 // Polymorphic function wrapper. Roughly equivalent to std::function.
-template <typename taResult, typename... taArgs>
-struct Function<taResult(taArgs...)>
+template <typename taResult, typename... taArgs, int taStorageSize>
+struct Function<taResult(taArgs...), taStorageSize>
 {
 	Function() = default;
-	
+
 	~Function()
 	{
 		if (IsValid())
@@ -25,7 +35,7 @@ struct Function<taResult(taArgs...)>
 	Function& operator=(const Function&) = delete;
 
 	template <typename taFunc>
-	requires (!cIsSame<RemoveReference<RemoveCV<taFunc>>, Function>)	// Don't accept Function types, this is not a copy-constructor.
+	requires (!Details::cIsFunction<RemoveReference<RemoveCV<taFunc>>>)	// Don't accept Function types, this is not a copy-constructor.
 	Function(taFunc&& ioFunc)
 	{
 		Construct(gForward<taFunc>(ioFunc));
@@ -47,7 +57,7 @@ struct Function<taResult(taArgs...)>
 
 		if (ioOther.IsValid())
 			ioOther.MoveTo(this);
-		
+
 		return *this;
 	}
 
@@ -77,7 +87,7 @@ private:
 	void Construct(taLambda&& ioLambda)
 	{
 		static_assert(alignof(taLambda) <= cStorageAlignment);
-		static_assert(sizeof(taLambda) <= cStorageSize);
+		static_assert(sizeof(taLambda) <= cStorageSize, "Capture too large, bump taStorageSize (eg. Function<void(), 64>).");
 		gAssert(!IsValid());
 
 		static const VTable sVTable {
@@ -97,7 +107,7 @@ private:
 		mVTable->mDestruct(mStorage);
 		mVTable = nullptr;
 	}
-	
+
 	void MoveTo(Function* ioTo)
 	{
 		gAssert(IsValid());
@@ -109,9 +119,47 @@ private:
 		Destruct();
 	}
 
-	static constexpr int cStorageSize      = sizeof(void*) * 4;
+	static constexpr int cStorageSize      = taStorageSize;
 	static constexpr int cStorageAlignment = alignof(void*);
 
 	const VTable* mVTable = nullptr;
 	alignas(cStorageAlignment) uint8 mStorage[cStorageSize];
-};
\ No newline at end of file
+};
+
+
+template <typename taType> struct FunctionRef;
+
+
+// Non-owning function wrapper. Roughly equivalent to std::function_ref.
+// It just points at an existing callable, so it never allocates, never copies the capture, and has
+// no size limit. Use it for call-and-return parameters (eg. a parallel-for body); the callable must
+// outlive the calls, so don't store a FunctionRef.
+template <typename taResult, typename... taArgs>
+struct FunctionRef<taResult(taArgs...)>
+{
+	FunctionRef() = default;
+
+	template <typename taFunc>
+	requires (!cIsSame<RemoveReference<RemoveCV<taFunc>>, FunctionRef>)	// Don't accept FunctionRef types, the default copy is what we want.
+	FunctionRef(taFunc&& ioFunc)
+	{
+		mCallable = (void*)&ioFunc;
+		mInvoke   = [](void* ioCallable, taArgs&&... ioArgs) -> taResult {
+			return (*(RemoveReference<taFunc>*)ioCallable)(gForward<taArgs>(ioArgs)...);
+		};
+	}
+
+	bool IsValid() const { return mInvoke != nullptr; }
+
+	[[nodiscard]] taResult operator()(taArgs&&... ioArgs) const
+	{
+		gAssert(IsValid());
+		return mInvoke(mCallable, gForward<taArgs>(ioArgs)...);
+	}
+
+private:
+	using InvokeFunc = taResult (*)(void*, taArgs&&...);
+
+	void*      mCallable = nullptr;
+	InvokeFunc mInvoke   = nullptr;
+};
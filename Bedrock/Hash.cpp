@@ -18,3 +18,87 @@ REGISTER_TEST("Hash")
 	uint64 hash2 = gHash(StringView("hello what's up"), hash);
 	TEST_TRUE(hash2 != hash);
 };
+
+
+REGISTER_TEST("Hasher")
+{
+	// Appending in parts matches the one-shot hash as long as the data fits the internal buffer.
+	const char data[] = "path/to/asset.dds v3 flags:7";
+	uint64 one_shot = gHash(data, sizeof(data));
+
+	Hasher hasher;
+	hasher.Append(Span((const uint8*)data, 10));
+	hasher.Append(Span((const uint8*)data + 10, sizeof(data) - 10));
+	TEST_TRUE(hasher.Final() == one_shot);
+
+	// Same with a seed.
+	Hasher seeded(42);
+	seeded.Append(Span((const uint8*)data, sizeof(data)));
+	TEST_TRUE(seeded.Final() == gHash(data, sizeof(data), 42));
+	TEST_TRUE(seeded.Final() != one_shot);
+
+	// Appending an integer is equivalent to appending its bytes.
+	uint32 value = 0xDEADBEEF;
+	Hasher int_hasher;
+	int_hasher.Append(value);
+	Hasher bytes_hasher;
+	bytes_hasher.Append(Span((const uint8*)&value, sizeof(value)));
+	TEST_TRUE(int_hasher.Final() == bytes_hasher.Final());
+
+	// Data larger than the internal buffer no longer matches one-shot, but must stay deterministic
+	// regardless of how the appends are split.
+	uint8 large[200];
+	for (int i = 0; i < (int)sizeof(large); i++)
+		large[i] = (uint8)i;
+
+	Hasher large_a;
+	large_a.Append(Span(large, 150));
+	large_a.Append(Span(large + 150, 50));
+
+	Hasher large_b;
+	large_b.Append(Span(large, 150));
+	large_b.Append(Span(large + 150, 50));
+
+	TEST_TRUE(large_a.Final() == large_b.Final());
+	TEST_TRUE(large_a.Final() != 0);
+
+	// gHashCombine is order dependent.
+	TEST_TRUE(gHashCombine(gHash(1), gHash(2)) != gHashCombine(gHash(2), gHash(1)));
+};
+
+
+REGISTER_TEST("HashLarge")
+{
+	uint8 buffer[1000];
+	for (int i = 0; i < (int)sizeof(buffer); i++)
+		buffer[i] = (uint8)(i * 7 + 13);
+
+	// Below one block it's the same as the one-shot hash.
+	TEST_TRUE(gHashLarge(buffer, 63) == gHash(buffer, 63));
+
+	// Deterministic, seed and content dependent.
+	uint64 hash = gHashLarge(buffer, sizeof(buffer));
+	TEST_TRUE(hash != 0);
+	TEST_TRUE(hash == gHashLarge(buffer, sizeof(buffer)));
+	TEST_TRUE(hash != gHashLarge(buffer, sizeof(buffer), 42));
+	TEST_TRUE(hash != gHashLarge(buffer, sizeof(buffer) - 1));
+
+	buffer[0] ^= 1;
+	TEST_TRUE(hash != gHashLarge(buffer, sizeof(buffer)));
+
+	// Sizes that aren't a multiple of the block size exercise the tail path.
+	TEST_TRUE(gHashLarge(buffer, 100) != gHashLarge(buffer, 99));
+};
+
+
+REGISTER_TEST("Crc32c")
+{
+	// Standard check value for CRC32C.
+	TEST_TRUE(gCrc32c("123456789", 9) == 0xE3069283);
+
+	TEST_TRUE(gCrc32c("", 0) == 0);
+
+	// Checksumming in several parts is equivalent to one call.
+	uint32 part = gCrc32c("123456", 6);
+	TEST_TRUE(gCrc32c("789", 3, part) == 0xE3069283);
+};
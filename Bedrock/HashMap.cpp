@@ -2,6 +2,7 @@
 #include <Bedrock/HashMap.h>
 #include <Bedrock/Test.h>
 #include <Bedrock/String.h>
+#include <Bedrock/StringFormat.h>
 #include <Bedrock/Random.h>
 
 
@@ -50,6 +51,114 @@ REGISTER_TEST("HashMap")
 };
 
 
+REGISTER_TEST("HashMap Transparent Lookup")
+{
+	// Hash<String> inherits the transparent Hash<StringView>, so String-keyed maps can be
+	// queried with a StringView or a const char* without materializing a String (no allocation).
+	HashMap<String, int> map;
+	map.Insert("bread", 1);
+	map.Insert("baguette", 2);
+
+	// Lookup with a StringView into a larger buffer (not null-terminated at the sub-string end).
+	StringView buffer = "bread and butter";
+	StringView bread  = buffer.SubStr(0, 5);
+	TEST_TRUE(map.Find(bread) != map.End());
+	TEST_TRUE(map.Find(bread)->mValue == 1);
+	TEST_TRUE(map.Contains(bread));
+
+	// Lookup with a const char*.
+	TEST_TRUE(map.Find("baguette")->mValue == 2);
+	TEST_TRUE(map.Contains("baguette"));
+	TEST_FALSE(map.Contains("brioche"));
+
+	// Transparent insert only materializes a String when the key is actually added.
+	TEST_TRUE(map.Insert(StringView("brioche"), 3).mResult == EInsertResult::Added);
+	TEST_TRUE(map.Insert(StringView("brioche"), 4).mResult == EInsertResult::Found);
+	TEST_TRUE(map[StringView("brioche")] == 3);
+
+	// Transparent erase.
+	TEST_TRUE(map.Erase(StringView("brioche")));
+	TEST_FALSE(map.Erase(StringView("brioche")));
+
+	// Same goes for sets.
+	HashSet<String> set;
+	set.Insert("bread");
+	TEST_TRUE(set.Contains(bread));
+	TEST_TRUE(set.Contains("bread"));
+	TEST_TRUE(set.Erase(bread));
+};
+
+
+REGISTER_TEST("CachedHashMap")
+{
+	CachedHashMap<String, int> map;
+
+	// Insert enough to force several Grows (which redistribute the cached hashes).
+	constexpr int cSize = 1000;
+	for (int i = 0; i < cSize; i++)
+		map.Insert(gFormat("key_%d", i), i);
+
+	for (int i = 0; i < cSize; i++)
+	{
+		auto iter = map.Find(gFormat("key_%d", i));
+		TEST_TRUE(iter != map.End());
+		TEST_TRUE(iter->mValue == i);
+	}
+
+	// Erase half the keys (exercises the cached hash swap-erase).
+	for (int i = 0; i < cSize; i += 2)
+		TEST_TRUE(map.Erase(gFormat("key_%d", i)));
+
+	for (int i = 1; i < cSize; i += 2)
+		TEST_TRUE(map.Find(gFormat("key_%d", i))->mValue == i);
+
+	// Copies must keep the cached hashes in sync.
+	CachedHashMap<String, int> map2 = map;
+	for (int i = 1; i < cSize; i += 2)
+		TEST_TRUE(map2.Find(gFormat("key_%d", i))->mValue == i);
+};
+
+
+REGISTER_TEST("HashMap FindBatch")
+{
+	HashMap<int, int> map;
+
+	constexpr int cSize = 10000;
+	for (int i = 0; i < cSize; i++)
+		map.Insert(i, i * 2);
+
+	// Look up a mix of present and absent keys.
+	Vector<int> keys;
+	for (int i = 0; i < cSize * 2; i++)
+		keys.PushBack(i);
+
+	Vector<HashMap<int, int>::ConstIter> results;
+	results.Resize(keys.Size(), EResizeInit::NoZeroInit);
+
+	map.FindBatch(Span(keys), Span(results));
+
+	for (int i = 0; i < keys.Size(); i++)
+	{
+		if (i < cSize)
+		{
+			TEST_TRUE(results[i] != map.End());
+			TEST_TRUE(results[i]->mKey == i);
+			TEST_TRUE(results[i]->mValue == i * 2);
+		}
+		else
+		{
+			TEST_TRUE(results[i] == map.End());
+		}
+	}
+
+	// An empty map should return End() for everything.
+	HashMap<int, int> empty_map;
+	empty_map.FindBatch(Span(keys), Span(results));
+	for (const auto& result : results)
+		TEST_TRUE(result == empty_map.End());
+};
+
+
 REGISTER_TEST("HashSet Reserve")
 {
 	HashSet<int> set;
@@ -230,3 +339,55 @@ REGISTER_TEST("Large VMem HashSet")
 	VMemHashSet<int> set;
 	sLargeHashSetTest(set);
 };
+
+
+REGISTER_TEST("HashMap EraseIf")
+{
+	HashMap<int, int> map;
+	for (int i = 0; i < 1000; i++)
+		map.Insert(i, i * 10);
+
+	// A predicate matching nothing erases nothing.
+	TEST_TRUE(map.EraseIf([](const KeyValue<int, int>&) { return false; }) == 0);
+	TEST_TRUE(map.Size() == 1000);
+
+	// Erase all the odd keys in one pass.
+	TEST_TRUE(map.EraseIf([](const KeyValue<int, int>& inKeyValue) { return (inKeyValue.mKey & 1) != 0; }) == 500);
+	TEST_TRUE(map.Size() == 500);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		if ((i & 1) == 0)
+			TEST_TRUE(map.Find(i)->mValue == i * 10);
+		else
+			TEST_TRUE(map.Find(i) == map.End());
+	}
+
+	// The map still works normally after the bucket rebuild.
+	TEST_TRUE(map.Insert(1001, 42).mResult == EInsertResult::Added);
+	TEST_TRUE(map.Erase(0));
+	TEST_TRUE(map.Find(1001)->mValue == 42);
+
+	// Erase everything.
+	TEST_TRUE(map.EraseIf([](const KeyValue<int, int>&) { return true; }) == 500);
+	TEST_TRUE(map.Empty());
+	TEST_TRUE(map.Insert(5, 50).mResult == EInsertResult::Added);
+
+	// Works on cached-hashes maps (the cached hashes are compacted along) and on sets.
+	CachedHashMap<String, int> cached_map;
+	cached_map.Insert("keep", 1);
+	cached_map.Insert("drop", 2);
+	cached_map.Insert("also keep", 3);
+	TEST_TRUE(cached_map.EraseIf([](const KeyValue<String, int>& inKeyValue) { return inKeyValue.mValue == 2; }) == 1);
+	TEST_TRUE(cached_map.Find("keep")->mValue == 1);
+	TEST_TRUE(cached_map.Find("also keep")->mValue == 3);
+	TEST_TRUE(cached_map.Find("drop") == cached_map.End());
+
+	HashSet<int> set;
+	for (int i = 0; i < 100; i++)
+		set.Insert(i);
+	TEST_TRUE(set.EraseIf([](int inKey) { return inKey >= 10; }) == 90);
+	TEST_TRUE(set.Size() == 10);
+	TEST_TRUE(set.Contains(9));
+	TEST_FALSE(set.Contains(10));
+};
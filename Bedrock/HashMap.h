@@ -67,18 +67,30 @@ struct SetInsertResult
 };
 
 
+namespace Details
+{
+	// Empty stand-in for the hash vector when hashes aren't cached (see taCacheHashes).
+	struct NoHashVector {};
+}
+
+
 // Dense HashMap class.
 // Heavily insipired from https://github.com/martinus/unordered_dense.
 // The key-values are stored contiguously (no holes), so iteration is very fast. Bucket metadata is stored separately.
 // Supports TempAllocator. Behaves as a set if taValue is void (see HashSet typedef) below.
+// If taCacheHashes is true, the full 64-bit hash of each key is stored next to the key-values,
+// making Grow a cheap redistribution instead of re-hashing every key. Worth it when hashing
+// keys is expensive (eg. long Strings) and the map grows often (see CachedHashMap typedef below).
 template <
 	typename taKey,
 	typename taValue,
 	typename taHash = Hash<taKey>,
-	template <typename> typename taAllocator = DefaultAllocator
+	template <typename> typename taAllocator = DefaultAllocator,
+	bool taCacheHashes = false
 >
 struct HashMap : taHash
 {
+	static constexpr bool cCacheHashes = taCacheHashes;
 	static constexpr bool cIsMap = !cIsVoid<taValue>;
 	static constexpr bool cIsSet =  cIsVoid<taValue>;
 
@@ -145,6 +157,23 @@ struct HashMap : taHash
 	}
 
 
+	// FindBatch ----------------------------------------------
+
+	// Find many keys at once. Writes one iterator per key into outResults (End() for keys that aren't found).
+	// The buckets and key-values of upcoming keys are software-prefetched while earlier keys are resolved,
+	// which pipelines the cache misses when the map is much larger than the caches.
+	void FindBatch(Span<const taKey> inKeys, Span<ConstIter> outResults) const
+	{
+		FindBatchInternal(inKeys, outResults);
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	void FindBatch(Span<const taAltKey> inKeys, Span<ConstIter> outResults) const
+	{
+		FindBatchInternal(inKeys, outResults);
+	}
+
 	// Contains -----------------------------------------------
 
 	bool Contains(const taKey& inKey) const
@@ -286,8 +315,62 @@ struct HashMap : taHash
 		return inIter;
 	}
 
+	// EraseIf (Map and Set) -----------------------------------
+
+	// Erase every key-value for which inPredicate returns true. Returns the number erased.
+	// Much faster than calling Erase in a loop for large purges: the key-values are compacted in
+	// one linear pass and the bucket metadata is rebuilt in a second one, instead of paying a
+	// backward-shift deletion with random bucket accesses per erased key.
+	template <typename taPredicate>
+	int EraseIf(taPredicate&& inPredicate)
+	{
+		const int size        = mKeyValues.Size();
+		int       write_index = 0;
+
+		for (int read_index = 0; read_index < size; read_index++)
+		{
+			if (inPredicate((const KeyValue&)mKeyValues[read_index]))
+				continue; // Erased, leave it behind.
+
+			if (write_index != read_index)
+			{
+				mKeyValues[write_index] = gMove(mKeyValues[read_index]);
+
+				if constexpr (cCacheHashes)
+					mHashes[write_index] = mHashes[read_index];
+			}
+
+			write_index++;
+		}
+
+		const int num_erased = size - write_index;
+		if (num_erased == 0)
+			return 0;
+
+		// Destroy the left-behind tail (no Resize, it would require default-constructible values).
+		while (mKeyValues.Size() > write_index)
+			mKeyValues.PopBack();
+
+		if constexpr (cCacheHashes)
+			mHashes.Resize(write_index);
+
+		// Rebuild the bucket metadata from scratch (same as the fill loop in Grow).
+		for (Bucket& bucket : mBuckets)
+			bucket = {};
+
+		for (int i = 0; i < write_index; i++)
+		{
+			bool key_may_be_found = false;
+			auto [bucket_index, distance_and_fingerprint, _] = FindBucketWithHash(GetKey(mKeyValues[i]), GetHashAt(i), key_may_be_found);
+
+			InsertBucket({ distance_and_fingerprint, i }, bucket_index);
+		}
+
+		return num_erased;
+	}
+
 	// Reserve (Map and Set) -----------------------------------
-	
+
 	void Reserve(int inCapacity)
 	{
 		if (inCapacity <= Capacity())
@@ -308,6 +391,8 @@ struct HashMap : taHash
 protected:
 	using Bucket = Details::HashMapBucket;
 
+	friend struct BlobWriter; // Serializes mKeyValues and mBuckets as-is (see Serialization.h).
+
 	// Get the mask to use when incrementing bucket indices to get wrap-around.
 	// The number of buckets is a power of 2, so we can use a bitwise and as a faster modulo.
 	int GetBucketSizeMask() const
@@ -338,22 +423,35 @@ protected:
 		mBuckets.ClearAndFreeMemory();
 		mKeyValues.Reserve(new_key_values_size);
 
+		if constexpr (cCacheHashes)
+			mHashes.Reserve(new_key_values_size);
+
 		// Re-allocate the buckets.
 		mBuckets.Resize(new_buckets_size);
 
 		// Fill the buckets.
-		for (const KeyValue& key_value : mKeyValues)
+		for (int i = 0, n = mKeyValues.Size(); i < n; i++)
 		{
 			// Find the right bucket index for this key.
 			// Note: We know the key is not already present so we can skip some compares.
+			// Note: With cached hashes this doesn't need to re-hash the key at all.
 			bool key_may_be_found = false;
-			auto [bucket_index, distance_and_fingerprint, _] = FindBucket(GetKey(key_value), key_may_be_found);
+			auto [bucket_index, distance_and_fingerprint, _] = FindBucketWithHash(GetKey(mKeyValues[i]), GetHashAt(i), key_may_be_found);
 
 			// Insert the bucket.
-			InsertBucket({ distance_and_fingerprint, mKeyValues.GetIndex(key_value) }, bucket_index);
+			InsertBucket({ distance_and_fingerprint, i }, bucket_index);
 		}
 	}
 
+	// Get the hash of the key-value at inIndex (cached, or re-calculated if hashes aren't stored).
+	uint64 GetHashAt(int inIndex) const
+	{
+		if constexpr (cCacheHashes)
+			return mHashes[inIndex];
+		else
+			return taHash::operator()(GetKey(mKeyValues[inIndex]));
+	}
+
 	// Internal function to find a key.
 	template <typename taAltKey>
 	Iter FindInternal(const taAltKey& inKey) const
@@ -372,6 +470,68 @@ protected:
 		return End();
 	}
 
+	// Internal function to find many keys at once, pipelining the memory accesses.
+	template <typename taAltKey>
+	void FindBatchInternal(Span<const taAltKey> inKeys, Span<ConstIter> outResults) const
+	{
+		gAssert(inKeys.Size() == outResults.Size());
+
+		if (Empty()) [[unlikely]]
+		{
+			for (ConstIter& result : outResults)
+				result = End();
+			return;
+		}
+
+		// Each key goes through a three-stage pipeline:
+		// - hash the key and prefetch its ideal bucket
+		// - once the bucket arrived, prefetch the key-value it points to (speculatively, it's
+		//   the right one unless the key was displaced or is absent)
+		// - once the key-value arrived, do the actual find
+		// The distances are chosen so that a cache miss per stage is fully hidden by the work
+		// done on the keys in between.
+		constexpr int cBucketDistance   = 8;	// Distance at which buckets are prefetched.
+		constexpr int cKeyValueDistance = 4;	// Distance at which key-values are prefetched.
+		static_assert(cBucketDistance > cKeyValueDistance);
+
+		const int buckets_mask = GetBucketSizeMask();
+		const int num_keys     = inKeys.Size();
+
+		// Small ring buffer keeping the hashes of the in-flight keys.
+		uint64 hashes[cBucketDistance];
+
+		// Prime the pipeline.
+		for (int i = 0, n = gMin(num_keys, cBucketDistance); i < n; i++)
+		{
+			hashes[i] = taHash::operator()(inKeys[i]);
+			gPrefetch(&mBuckets[(int)hashes[i] & buckets_mask]);
+		}
+
+		for (int i = 0; i < num_keys; i++)
+		{
+			// Prefetch the key-value pointed by the ideal bucket of an upcoming key.
+			// Note: Empty buckets are zero-initialized so their index is always valid to prefetch.
+			if (i + cKeyValueDistance < num_keys)
+			{
+				uint64 hash = hashes[(i + cKeyValueDistance) % cBucketDistance];
+				gPrefetch(&mKeyValues[mBuckets[(int)hash & buckets_mask].mKeyValueIndex]);
+			}
+
+			// Resolve the current key. This has to happen before its ring slot is reused below
+			// (key i and key i + cBucketDistance share the same slot).
+			auto [bucket_index, _, found] = FindBucketWithHash(inKeys[i], hashes[i % cBucketDistance]);
+			outResults[i] = found ? (mKeyValues.Begin() + mBuckets[bucket_index].mKeyValueIndex) : End();
+
+			// Hash an upcoming key, store it in the freed ring slot and prefetch its ideal bucket.
+			if (i + cBucketDistance < num_keys)
+			{
+				uint64 hash = taHash::operator()(inKeys[i + cBucketDistance]);
+				hashes[i % cBucketDistance] = hash;
+				gPrefetch(&mBuckets[(int)hash & buckets_mask]);
+			}
+		}
+	}
+
 	enum class EReplaceExisting
 	{
 		No,
@@ -386,7 +546,8 @@ protected:
 			Grow(mBuckets.Size() * 2);
 
 		// Try to find the key.
-		auto [bucket_index, distance_and_fingerprint, found] = FindBucket(ioKey);
+		const uint64 hash = taHash::operator()(ioKey);
+		auto [bucket_index, distance_and_fingerprint, found] = FindBucketWithHash(ioKey, hash);
 
 		if (found)
 		{
@@ -409,6 +570,9 @@ protected:
 		// Key does not exist, add it.
 		mKeyValues.EmplaceBack(gForward<taAltKey>(ioKey), gForward<taArgs>(ioArgs)...);
 
+		if constexpr (cCacheHashes)
+			mHashes.PushBack(hash);
+
 		// Insert a new bucket for it.
 		Bucket new_bucket = { distance_and_fingerprint, mKeyValues.Size() - 1 };
 		InsertBucket(new_bucket, bucket_index);
@@ -439,6 +603,10 @@ protected:
 		if (key_value_index_to_erase == mKeyValues.Size() - 1)
 		{
 			mKeyValues.PopBack();
+
+			if constexpr (cCacheHashes)
+				mHashes.PopBack();
+
 			return true;
 		}
 
@@ -446,7 +614,7 @@ protected:
 		int last_key_value_index = mKeyValues.Size() - 1;
 
 		// We also need to find the bucket of the key we will swap to update its index.
-		const uint64 hash         = taHash::operator()(GetKey(mKeyValues.Back()));
+		const uint64 hash         = GetHashAt(last_key_value_index);
 		const int    buckets_mask = GetBucketSizeMask();
 		bucket_index              = (int)hash & buckets_mask;
 
@@ -471,6 +639,9 @@ protected:
 		// Swap-erase the key-value.
 		mKeyValues.SwapErase(key_value_index_to_erase);
 
+		if constexpr (cCacheHashes)
+			mHashes.SwapErase(key_value_index_to_erase);
+
 		return true;
 	}
 
@@ -486,8 +657,14 @@ protected:
 	template <typename taAltKey>
 	FindBucketResult FindBucket(const taAltKey& inKey, bool inKeyMayBeFound = true) const
 	{
-		// Calculate the hash.
-		const uint64 hash = taHash::operator()(inKey);
+		return FindBucketWithHash(inKey, taHash::operator()(inKey), inKeyMayBeFound);
+	}
+
+	// Find the bucket where a key is (or should be), with the hash already calculated.
+	template <typename taAltKey>
+	FindBucketResult FindBucketWithHash(const taAltKey& inKey, uint64 inHash, bool inKeyMayBeFound = true) const
+	{
+		const uint64 hash = inHash;
 
 		// Get the ideal bucket index.
 		const int buckets_mask = GetBucketSizeMask();
@@ -583,9 +760,11 @@ protected:
 
 	using KeyValueVector = Vector<KeyValue, taAllocator<KeyValue>>;
 	using BucketVector = Vector<Bucket, taAllocator<Bucket>>;
+	using HashVector = Conditional<cCacheHashes, Vector<uint64, taAllocator<uint64>>, Details::NoHashVector>;
 
 	KeyValueVector	mKeyValues;		// Key-value pairs stored in a dense array.
 	BucketVector	mBuckets;		// Bucket metadata.
+	HashVector		mHashes;		// Cached hash of each key-value (empty struct if !cCacheHashes).
 };
 
 
@@ -656,6 +835,18 @@ private:
 };
 
 
+// Alias for a HashMap that stores the full 64-bit hash next to each key-value.
+// Grow redistributes the cached hashes instead of re-hashing every key, which makes
+// a big difference when keys are expensive to hash (eg. long Strings).
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+using CachedHashMap = HashMap<taKey, taValue, taHash, taAllocator, true>;
+
+
 // HashSet variant of the HashMap (no values).
 template <
 	typename taKey,
@@ -665,6 +856,15 @@ template <
 using HashSet = HashMap<taKey, void, taHash, taAllocator>;
 
 
+// HashSet variant storing cached hashes (see CachedHashMap).
+template <
+	typename taKey,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+using CachedHashSet = HashMap<taKey, void, taHash, taAllocator, true>;
+
+
 // Alias for a HashSet using the TempAllocator.
 // Resize without moving the Keys as long as it's the last Temp allocation (still needs a rehash). Allocates from the heap as a fallback.
 template <
@@ -684,35 +884,44 @@ template <
 using VMemHashSet = VMemHashMap<taKey, void, taHash>;
 
 
-template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
-HashMap<taKey, taValue, taHash, taAllocator>::HashMap(const HashMap& inOther)
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator, bool taCacheHashes>
+HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>::HashMap(const HashMap& inOther)
 {
 	*this = inOther;
 }
 
 
-template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
-HashMap<taKey, taValue, taHash, taAllocator>& HashMap<taKey, taValue, taHash, taAllocator>::operator=(
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator, bool taCacheHashes>
+HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>& HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>::operator=(
 	const HashMap& inOther)
 {
 	Clear();
-		
+
 	mKeyValues.Reserve(inOther.mKeyValues.Capacity());
 	mBuckets.Reserve(inOther.mBuckets.Capacity());
 
 	mKeyValues = inOther.mKeyValues;
 	mBuckets   = inOther.mBuckets;
 
+	if constexpr (cCacheHashes)
+	{
+		mHashes.Reserve(inOther.mHashes.Capacity());
+		mHashes = inOther.mHashes;
+	}
+
 	return *this;
 }
 
 
-template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
-void HashMap<taKey, taValue, taHash, taAllocator>::Clear()
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator, bool taCacheHashes>
+void HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>::Clear()
 {
 	mKeyValues.Clear();
 	mBuckets.Clear();
 	mBuckets.Resize(mBuckets.Capacity());
+
+	if constexpr (cCacheHashes)
+		mHashes.Clear();
 }
 
 
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/MPMCQueue.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/String.h>
+
+
+REGISTER_TEST("MPMCQueue")
+{
+	MPMCQueue<int, 4> queue;
+
+	// Empty queue.
+	int value;
+	TEST_FALSE(queue.TryPop(value));
+
+	// FIFO order.
+	TEST_TRUE(queue.TryPush(1));
+	TEST_TRUE(queue.TryPush(2));
+	TEST_TRUE(queue.TryPush(3));
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 1);
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 2);
+
+	// Fill it up.
+	TEST_TRUE(queue.TryPush(4));
+	TEST_TRUE(queue.TryPush(5));
+	TEST_TRUE(queue.TryPush(6));
+	TEST_FALSE(queue.TryPush(7)); // Full.
+
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 3);
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 4);
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 5);
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 6);
+	TEST_FALSE(queue.TryPop(value)); // Empty again.
+
+	// Sequence numbers should survive wrapping around the buffer many times.
+	for (int i = 0; i < 100; i++)
+	{
+		TEST_TRUE(queue.TryPush(i));
+		TEST_TRUE(queue.TryPop(value));
+		TEST_TRUE(value == i);
+	}
+
+	// Non-trivial element type; elements left in the queue are destructed with it.
+	{
+		MPMCQueue<String, 4> string_queue;
+		TEST_TRUE(string_queue.TryPush(String("a rather long string that heap-allocates")));
+		TEST_TRUE(string_queue.TryPush(String("another rather long string")));
+
+		String str;
+		TEST_TRUE(string_queue.TryPop(str));
+		TEST_TRUE(str == "a rather long string that heap-allocates");
+	}
+};
+
+
+REGISTER_TEST("MPMCQueue Threaded")
+{
+	// Two producers and two consumers hammering a small queue.
+	constexpr int cValuesPerProducer = 10000;
+	constexpr int cNumProducers      = 2;
+	constexpr int cNumConsumers      = 2;
+
+	MPMCQueue<int, 64> queue;
+	AtomicInt64        total_popped = 0;
+	AtomicInt64        sum          = 0;
+	AtomicInt32        producers_done = 0;
+
+	Thread producers[cNumProducers];
+	Thread consumers[cNumConsumers];
+
+	for (Thread& producer : producers)
+		producer.Create({ .mName = "Producer", .mTempMemSize = 0 }, [&queue, &producers_done](Thread&)
+		{
+			for (int i = 1; i <= cValuesPerProducer; i++)
+				while (!queue.TryPush(i))
+					gYieldThread();
+
+			producers_done.Add(1);
+		});
+
+	for (Thread& consumer : consumers)
+		consumer.Create({ .mName = "Consumer", .mTempMemSize = 0 }, [&queue, &total_popped, &sum, &producers_done](Thread&)
+		{
+			while (true)
+			{
+				int value;
+				if (queue.TryPop(value))
+				{
+					sum.Add(value);
+					total_popped.Add(1);
+				}
+				else if (producers_done.Load() == cNumProducers)
+				{
+					// Producers are done; one last pop to catch stragglers, then stop.
+					if (!queue.TryPop(value))
+						break;
+					sum.Add(value);
+					total_popped.Add(1);
+				}
+				else
+				{
+					gYieldThread();
+				}
+			}
+		});
+
+	for (Thread& producer : producers)
+		producer.Join();
+	for (Thread& consumer : consumers)
+		consumer.Join();
+
+	constexpr int64 cExpectedSum = (int64)cNumProducers * cValuesPerProducer * (cValuesPerProducer + 1) / 2;
+	TEST_TRUE(total_popped.Load() == cNumProducers * cValuesPerProducer);
+	TEST_TRUE(sum.Load() == cExpectedSum);
+};
+
+
+REGISTER_TEST("BlockingMPMCQueue")
+{
+	constexpr int cNumValues = 10000;
+
+	// A tiny queue forces both sides to block.
+	BlockingMPMCQueue<int, 8> queue;
+	int64                     sum = 0;
+
+	Thread producer;
+	producer.Create({ .mName = "Producer", .mTempMemSize = 0 }, [&queue](Thread&)
+	{
+		for (int i = 1; i <= cNumValues; i++)
+			queue.Push(i);
+	});
+
+	// Consume on this thread.
+	for (int i = 0; i < cNumValues; i++)
+		sum += queue.Pop();
+
+	producer.Join();
+
+	TEST_TRUE(sum == (int64)cNumValues * (cNumValues + 1) / 2);
+
+	// The Try variants also maintain the semaphore counts.
+	TEST_TRUE(queue.TryPush(1));
+	int value;
+	TEST_TRUE(queue.TryPop(value));
+	TEST_TRUE(value == 1);
+	TEST_FALSE(queue.TryPop(value));
+};
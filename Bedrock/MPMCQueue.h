@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Move.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Semaphore.h>
+#include <Bedrock/Thread.h>
+
+
+// Bounded lock-free multi-producer/multi-consumer queue (Dmitry Vyukov's design).
+// Every cell carries a sequence number that tells producers and consumers whether the cell is
+// ready for them; the hot path is one compare-exchange per operation and never allocates.
+// Note: The cell sequence loads/stores and the position CompareExchange use SeqCst (the sequence
+// is what publishes the cell contents); the initial position reads are Relaxed since the
+// CompareExchange revalidates them.
+template <typename taType, int taCapacity>
+struct MPMCQueue : NoCopy
+{
+	static_assert(gIsPow2(taCapacity));
+
+	MPMCQueue()
+	{
+		for (int i = 0; i < taCapacity; i++)
+			mCells[i].mSequence.Store(i, MemoryOrder::Relaxed);
+	}
+
+	~MPMCQueue()
+	{
+		// Destruct whatever is still queued. No concurrent access is allowed at this point.
+		int64 pos = mPopPos.Load(MemoryOrder::Relaxed);
+		while (true)
+		{
+			Cell& cell = mCells[pos & (taCapacity - 1)];
+			if (cell.mSequence.Load(MemoryOrder::Relaxed) != pos + 1)
+				break;
+
+			((taType*)cell.mStorage)->~taType();
+			pos++;
+		}
+	}
+
+	static constexpr int Capacity() { return taCapacity; }
+
+	// Add an element to the queue. Returns false if the queue is full.
+	template <typename taValue>
+	bool TryPush(taValue&& ioValue)
+	{
+		int64 pos = mPushPos.Load(MemoryOrder::Relaxed);
+
+		while (true)
+		{
+			Cell& cell = mCells[pos & (taCapacity - 1)];
+			int64 seq  = cell.mSequence.Load();
+
+			if (seq == pos)
+			{
+				// The cell is free, try to claim it.
+				if (mPushPos.CompareExchange(pos, pos + 1))
+				{
+					gPlacementNew(*(taType*)cell.mStorage, gForward<taValue>(ioValue));
+					cell.mSequence.Store(pos + 1);
+					return true;
+				}
+				// CompareExchange failed and updated pos, retry with it.
+			}
+			else if (seq < pos)
+			{
+				return false; // The cell is still occupied, the queue is full.
+			}
+			else
+			{
+				pos = mPushPos.Load(MemoryOrder::Relaxed); // Someone else claimed this cell, retry.
+			}
+		}
+	}
+
+	// Remove the oldest element from the queue. Returns false if the queue is empty.
+	bool TryPop(taType& outValue)
+	{
+		int64 pos = mPopPos.Load(MemoryOrder::Relaxed);
+
+		while (true)
+		{
+			Cell& cell = mCells[pos & (taCapacity - 1)];
+			int64 seq  = cell.mSequence.Load();
+
+			if (seq == pos + 1)
+			{
+				// The cell contains an element, try to claim it.
+				if (mPopPos.CompareExchange(pos, pos + 1))
+				{
+					taType& value = *(taType*)cell.mStorage;
+					outValue      = gMove(value);
+					value.~taType();
+					cell.mSequence.Store(pos + taCapacity);
+					return true;
+				}
+				// CompareExchange failed and updated pos, retry with it.
+			}
+			else if (seq < pos + 1)
+			{
+				return false; // The cell is empty, the queue is empty.
+			}
+			else
+			{
+				pos = mPopPos.Load(MemoryOrder::Relaxed); // Someone else claimed this cell, retry.
+			}
+		}
+	}
+
+private:
+	struct Cell
+	{
+		Atomic<int64>    mSequence;
+		alignas(taType) uint8 mStorage[sizeof(taType)];
+	};
+
+	alignas(64) Atomic<int64> mPushPos = 0; // On its own cache line, producers hammer it.
+	alignas(64) Atomic<int64> mPopPos  = 0; // Same for consumers.
+	alignas(64) Cell          mCells[taCapacity];
+};
+
+
+// Blocking variant of MPMCQueue: Push waits for a free slot, Pop waits for an element.
+// Two semaphores track free slots and queued elements; the queue itself is unchanged.
+template <typename taType, int taCapacity>
+struct BlockingMPMCQueue : NoCopy
+{
+	static constexpr int Capacity() { return taCapacity; }
+
+	// Add an element to the queue, waiting for a free slot if it is full.
+	template <typename taValue>
+	void Push(taValue&& ioValue)
+	{
+		mFreeSlots.Acquire();
+
+		// The semaphore guarantees a free slot, but a concurrent Pop may not have released
+		// its cell quite yet, so spin on TryPush.
+		while (!mQueue.TryPush(gForward<taValue>(ioValue)))
+			gYieldThread();
+
+		mQueuedElements.Release();
+	}
+
+	// Remove the oldest element from the queue, waiting for one if it is empty.
+	taType Pop()
+	{
+		mQueuedElements.Acquire();
+
+		// Same as in Push, a concurrent Push may not have published its element quite yet.
+		taType value;
+		while (!mQueue.TryPop(value))
+			gYieldThread();
+
+		mFreeSlots.Release();
+		return value;
+	}
+
+	// Non-blocking variants, for callers that mix both styles.
+	template <typename taValue>
+	bool TryPush(taValue&& ioValue)
+	{
+		if (!mFreeSlots.TryAcquire())
+			return false;
+
+		while (!mQueue.TryPush(gForward<taValue>(ioValue)))
+			gYieldThread();
+
+		mQueuedElements.Release();
+		return true;
+	}
+
+	bool TryPop(taType& outValue)
+	{
+		if (!mQueuedElements.TryAcquire())
+			return false;
+
+		while (!mQueue.TryPop(outValue))
+			gYieldThread();
+
+		mFreeSlots.Release();
+		return true;
+	}
+
+private:
+	MPMCQueue<taType, taCapacity> mQueue;
+	Semaphore                     mFreeSlots      = { taCapacity, taCapacity };
+	Semaphore                     mQueuedElements = { 0, taCapacity };
+};
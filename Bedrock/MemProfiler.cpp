@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/MemProfiler.h>
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Trace.h>
+
+
+namespace Details
+{
+	bool gMemProfilerEnabled = false;
+}
+
+namespace
+{
+
+// Size classes are power-of-two buckets: class N covers ((2^(N-1)), 2^N] bytes.
+constexpr int cNumSizeClasses = 31;
+
+int sGetSizeClass(int64 inSize)
+{
+	if (inSize <= 1)
+		return 0;
+
+	return gMin(64 - gCountLeadingZeros64((uint64)inSize - 1), cNumSizeClasses - 1);
+}
+
+
+struct MemProfiler
+{
+	static constexpr int cMaxCallsites = 1024;
+
+	// Cumulative stats for one gMemAlloc callsite (keyed on its return address).
+	struct Callsite
+	{
+		Atomic<void*> mAddress;
+		AtomicInt64   mTotalBytes;
+		AtomicInt64   mTotalCount;
+	};
+
+	AtomicInt64 mCurrentBytes;
+	AtomicInt64 mPeakBytes;
+	AtomicInt64 mCurrentCount;
+	AtomicInt64 mTotalBytes;
+	AtomicInt64 mTotalCount;
+
+	AtomicInt64 mClassCurrentCount[cNumSizeClasses];
+	AtomicInt64 mClassTotalCount[cNumSizeClasses];
+
+	Callsite    mCallsites[cMaxCallsites]; // Open addressing on the return address.
+	AtomicInt64 mCallsiteOverflowCount;    // Allocations that didn't fit in the callsite table.
+};
+
+// Note: Zero-initialized because it has static storage duration; that's what makes the atomic
+// arrays start at zero without running any constructors.
+MemProfiler sMemProfiler;
+
+} // namespace
+
+
+void Details::MemProfilerRegisterAlloc(MemBlock inMemory, void* inReturnAddress)
+{
+	MemProfiler& profiler = sMemProfiler;
+
+	int64 current = profiler.mCurrentBytes.Add(inMemory.mSize) + inMemory.mSize;
+	profiler.mCurrentCount.Add(1);
+	profiler.mTotalBytes.Add(inMemory.mSize);
+	profiler.mTotalCount.Add(1);
+
+	// Update the peak. CompareExchange reloads the peak on failure, so this converges.
+	int64 peak = profiler.mPeakBytes.Load();
+	while (current > peak && !profiler.mPeakBytes.CompareExchange(peak, current)) {}
+
+	int size_class = sGetSizeClass(inMemory.mSize);
+	profiler.mClassCurrentCount[size_class].Add(1);
+	profiler.mClassTotalCount[size_class].Add(1);
+
+	// Find or claim this callsite's slot, linear probing from a hash of the address.
+	uint64 slot = ((uint64)inReturnAddress * 0x9E3779B97F4A7C15ull) >> 32;
+	for (int probe = 0; probe < MemProfiler::cMaxCallsites; probe++)
+	{
+		MemProfiler::Callsite& callsite = profiler.mCallsites[(slot + probe) & (MemProfiler::cMaxCallsites - 1)];
+
+		void* address = callsite.mAddress.Load(MemoryOrder::Relaxed);
+		if (address == nullptr)
+		{
+			// Empty slot, try to claim it. On failure another thread claimed it; re-check whose it is.
+			if (!callsite.mAddress.CompareExchange(address, inReturnAddress))
+				if (address != inReturnAddress)
+					continue;
+		}
+		else if (address != inReturnAddress)
+			continue;
+
+		callsite.mTotalBytes.Add(inMemory.mSize);
+		callsite.mTotalCount.Add(1);
+		return;
+	}
+
+	// The table is full.
+	profiler.mCallsiteOverflowCount.Add(1);
+}
+
+
+void Details::MemProfilerRegisterFree(MemBlock inMemory)
+{
+	MemProfiler& profiler = sMemProfiler;
+
+	profiler.mCurrentBytes.Sub(inMemory.mSize);
+	profiler.mCurrentCount.Sub(1);
+	profiler.mClassCurrentCount[sGetSizeClass(inMemory.mSize)].Sub(1);
+}
+
+
+void gMemProfilerStart()
+{
+	Details::gMemProfilerEnabled = true;
+}
+
+
+void gMemProfilerStop()
+{
+	Details::gMemProfilerEnabled = false;
+}
+
+
+void gMemProfilerReset()
+{
+	gAssert(!Details::gMemProfilerEnabled); // Resetting while recording would leave the counters inconsistent.
+
+	MemProfiler& profiler = sMemProfiler;
+
+	profiler.mCurrentBytes.Store(0);
+	profiler.mPeakBytes.Store(0);
+	profiler.mCurrentCount.Store(0);
+	profiler.mTotalBytes.Store(0);
+	profiler.mTotalCount.Store(0);
+	profiler.mCallsiteOverflowCount.Store(0);
+
+	for (int i = 0; i < cNumSizeClasses; i++)
+	{
+		profiler.mClassCurrentCount[i].Store(0);
+		profiler.mClassTotalCount[i].Store(0);
+	}
+
+	for (MemProfiler::Callsite& callsite : profiler.mCallsites)
+	{
+		callsite.mAddress.Store(nullptr);
+		callsite.mTotalBytes.Store(0);
+		callsite.mTotalCount.Store(0);
+	}
+}
+
+
+int64 gMemProfilerGetCurrentBytes()	{ return sMemProfiler.mCurrentBytes.Load(); }
+int64 gMemProfilerGetPeakBytes()	{ return sMemProfiler.mPeakBytes.Load(); }
+int64 gMemProfilerGetCurrentCount()	{ return sMemProfiler.mCurrentCount.Load(); }
+int64 gMemProfilerGetTotalCount()	{ return sMemProfiler.mTotalCount.Load(); }
+
+
+void gMemProfilerDumpSnapshot(int inMaxCallsites)
+{
+	MemProfiler& profiler = sMemProfiler;
+
+	gTrace("Memory profiler snapshot:");
+	gTrace("  Current: %lld bytes in %lld allocations (peak %lld bytes)",
+		profiler.mCurrentBytes.Load(), profiler.mCurrentCount.Load(), profiler.mPeakBytes.Load());
+	gTrace("  Total:   %lld bytes in %lld allocations",
+		profiler.mTotalBytes.Load(), profiler.mTotalCount.Load());
+
+	for (int i = 0; i < cNumSizeClasses; i++)
+	{
+		int64 total = profiler.mClassTotalCount[i].Load();
+		if (total > 0)
+			gTrace("  <= %lld bytes: %lld current, %lld total",
+				(int64)1 << i, profiler.mClassCurrentCount[i].Load(), total);
+	}
+
+	// Gather and sort the callsites by allocated bytes.
+	struct CallsiteSnapshot
+	{
+		void* mAddress;
+		int64 mTotalBytes;
+		int64 mTotalCount;
+	};
+	CallsiteSnapshot snapshots[MemProfiler::cMaxCallsites];
+	int              num_snapshots = 0;
+
+	for (const MemProfiler::Callsite& callsite : profiler.mCallsites)
+	{
+		void* address = callsite.mAddress.Load();
+		if (address != nullptr)
+			snapshots[num_snapshots++] = { address, callsite.mTotalBytes.Load(), callsite.mTotalCount.Load() };
+	}
+
+	gSort(snapshots, snapshots + num_snapshots,
+		[](const CallsiteSnapshot& inA, const CallsiteSnapshot& inB) { return inA.mTotalBytes > inB.mTotalBytes; });
+
+	gTrace("  Top callsites (by total allocated bytes):");
+	for (int i = 0, n = gMin(num_snapshots, inMaxCallsites); i < n; i++)
+		gTrace("  %p: %lld bytes, %lld allocations", snapshots[i].mAddress, snapshots[i].mTotalBytes, snapshots[i].mTotalCount);
+
+	int64 overflow = profiler.mCallsiteOverflowCount.Load();
+	if (overflow > 0)
+		gTrace("  (%lld allocations from callsites that didn't fit in the table)", overflow);
+}
+
+
+REGISTER_TEST_SERIAL("MemProfiler")
+{
+	gMemProfilerReset();
+	gMemProfilerStart();
+
+	MemBlock b1 = gMemAlloc(100);
+	MemBlock b2 = gMemAlloc(1000);
+	TEST_TRUE(gMemProfilerGetCurrentBytes() == 1100);
+	TEST_TRUE(gMemProfilerGetCurrentCount() == 2);
+	TEST_TRUE(gMemProfilerGetPeakBytes() >= 1100);
+
+	gMemFree(b1);
+	TEST_TRUE(gMemProfilerGetCurrentBytes() == 1000);
+	TEST_TRUE(gMemProfilerGetPeakBytes() >= 1100); // The peak doesn't go down.
+
+	gMemFree(b2);
+	TEST_TRUE(gMemProfilerGetCurrentBytes() == 0);
+	TEST_TRUE(gMemProfilerGetCurrentCount() == 0);
+	TEST_TRUE(gMemProfilerGetTotalCount() == 2);
+
+	gMemProfilerStop();
+	gMemProfilerReset();
+};
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Memory.h>
+
+// Let's save including intrin.h for just one function.
+#if defined(_MSC_VER) && !defined(__clang__)
+extern "C" void* _ReturnAddress(void);
+#pragma intrinsic(_ReturnAddress)
+#define BEDROCK_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define BEDROCK_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+
+// Allocation profiler. While started, every gMemAlloc/gMemFree updates current/peak/total byte and
+// count counters, per-size-class counters, and cumulative per-callsite stats (keyed on the return
+// address of the gMemAlloc call, resolvable to a symbol with the usual debugger/tooling).
+// Everything is lock-free atomics, cheap enough to leave enabled on production builds when chasing
+// memory growth. Note that arena-backed containers don't go through gMemAlloc for every element;
+// use MemArena::GetAllocatedSize/GetPeakAllocatedSize to track those arenas directly.
+
+// Start/stop updating the counters. Stopping doesn't clear them.
+void gMemProfilerStart();
+void gMemProfilerStop();
+
+// Reset all counters to zero.
+void gMemProfilerReset();
+
+// Trace a snapshot: totals, per-size-class counts, and the top callsites by allocated bytes.
+void gMemProfilerDumpSnapshot(int inMaxCallsites = 20);
+
+// Query the global counters.
+int64 gMemProfilerGetCurrentBytes();
+int64 gMemProfilerGetPeakBytes();
+int64 gMemProfilerGetCurrentCount();
+int64 gMemProfilerGetTotalCount();
+
+
+namespace Details
+{
+	// True while the profiler is updating counters. Only written by gMemProfilerStart/gMemProfilerStop.
+	extern bool gMemProfilerEnabled;
+
+	void MemProfilerRegisterAlloc(MemBlock inMemory, void* inReturnAddress);
+	void MemProfilerRegisterFree(MemBlock inMemory);
+}
@@ -1,19 +1,218 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/Memory.h>
+#include <Bedrock/MemProfiler.h>
+#include <Bedrock/Mutex.h>
+#include <Bedrock/Random.h>
 #include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
 
 #include <stdlib.h>
 #include <Windows.h>
+#include <emmintrin.h> // The non-temporal kernels use SSE2 streaming stores, part of baseline x64.
+
+
+// Thread-caching front-end for the heap: small allocations are served from per-thread free lists
+// bucketed by size class, with batch refills/flushes to a shared central cache, so they don't
+// serialize on the process-wide heap lock. Can be disabled by defining MEM_THREAD_CACHE_ENABLED
+// to 0. Recycling memory without returning it to the heap hides use-after-frees from ASAN, so the
+// cache is disabled by default in that config.
+#if !defined(MEM_THREAD_CACHE_ENABLED) && !defined(__SANITIZE_ADDRESS__)
+#define MEM_THREAD_CACHE_ENABLED 1
+#endif
+
+
+#if MEM_THREAD_CACHE_ENABLED
+
+namespace
+{
+	// Size classes are multiples of 16 bytes, up to 256 bytes. Larger allocations go to the heap.
+	constexpr int   cSizeClassShift   = 4;
+	constexpr int   cSizeClassSize    = 1 << cSizeClassShift;
+	constexpr int   cNumSizeClasses   = 16;
+	constexpr int64 cMaxCachedSize    = cNumSizeClasses * cSizeClassSize;
+	constexpr int   cBatchSize        = 32;  // How many objects move between a thread cache and the central cache at once.
+	constexpr int   cMaxPerClassCount = 128; // How many objects a thread cache keeps per class before flushing a batch.
+
+	// The free list link is stored inside the free memory itself.
+	struct FreeObject
+	{
+		FreeObject* mNext;
+	};
+
+	force_inline int   sGetSizeClass(int64 inSize) { gAssert(inSize > 0 && inSize <= cMaxCachedSize); return (int)((inSize - 1) >> cSizeClassShift); }
+	force_inline int64 sGetClassSize(int inClass)  { return (int64)(inClass + 1) * cSizeClassSize; }
+
+	// Central cache shared by all threads. Refilled by carving slabs out of the heap.
+	struct CentralCache
+	{
+		// Pop up to inCount objects, return the chain and its actual length.
+		FreeObject* PopBatch(int inClass, int inCount, int& outCount)
+		{
+			{
+				LockGuard lock(mMutex);
+
+				if (mFreeLists[inClass] != nullptr)
+				{
+					FreeObject* head  = mFreeLists[inClass];
+					FreeObject* tail  = head;
+					int         count = 1;
+
+					while (count < inCount && tail->mNext != nullptr)
+					{
+						tail = tail->mNext;
+						count++;
+					}
+
+					mFreeLists[inClass]  = tail->mNext;
+					mFreeCounts[inClass] -= count;
+					tail->mNext          = nullptr;
+
+					outCount = count;
+					return head;
+				}
+			}
+
+			// The central list is empty: carve a new slab out of the heap (outside the lock).
+			// Note: Slabs are never returned to the heap; cached memory stays in the caches, like
+			// every allocator of this kind.
+			int64  class_size = sGetClassSize(inClass);
+			uint8* slab       = (uint8*)malloc(class_size * inCount);
+
+			FreeObject* head = nullptr;
+			for (int i = inCount - 1; i >= 0; i--)
+			{
+				FreeObject* object = (FreeObject*)(slab + i * class_size);
+				object->mNext      = head;
+				head               = object;
+			}
+
+			outCount = inCount;
+			return head;
+		}
+
+		// Push a nullptr-terminated chain of inCount objects.
+		void PushBatch(int inClass, FreeObject* inChain, int inCount)
+		{
+			gAssert(inChain != nullptr && inCount > 0);
+
+			FreeObject* tail = inChain;
+			while (tail->mNext != nullptr)
+				tail = tail->mNext;
+
+			LockGuard lock(mMutex);
+
+			tail->mNext          = mFreeLists[inClass];
+			mFreeLists[inClass]  = inChain;
+			mFreeCounts[inClass] += inCount;
+		}
+
+	private:
+		Mutex       mMutex;
+		FreeObject* mFreeLists[cNumSizeClasses]  = {};
+		int         mFreeCounts[cNumSizeClasses] = {};
+	};
+
+	CentralCache sCentralCache;
+
+	// Per-thread cache. Flushes everything back to the central cache on thread exit.
+	struct ThreadCache
+	{
+		~ThreadCache()
+		{
+			for (int size_class = 0; size_class < cNumSizeClasses; size_class++)
+			{
+				if (mFreeLists[size_class] != nullptr)
+					sCentralCache.PushBatch(size_class, mFreeLists[size_class], mFreeCounts[size_class]);
+
+				mFreeLists[size_class]  = nullptr;
+				mFreeCounts[size_class] = 0;
+			}
+		}
+
+		FreeObject* mFreeLists[cNumSizeClasses]  = {};
+		int         mFreeCounts[cNumSizeClasses] = {};
+	};
+
+	thread_local ThreadCache sThreadCache;
+
+	uint8* sThreadCacheAlloc(int64 inSize)
+	{
+		if (inSize <= 0 || inSize > cMaxCachedSize)
+			return (uint8*)malloc(inSize);
+
+		int          size_class = sGetSizeClass(inSize);
+		ThreadCache& cache      = sThreadCache;
+
+		FreeObject* object = cache.mFreeLists[size_class];
+		if (object == nullptr) [[unlikely]]
+		{
+			int count = 0;
+			object = sCentralCache.PopBatch(size_class, cBatchSize, count);
+
+			cache.mFreeLists[size_class]  = object;
+			cache.mFreeCounts[size_class] = count;
+		}
+
+		cache.mFreeLists[size_class] = object->mNext;
+		cache.mFreeCounts[size_class]--;
+
+		return (uint8*)object;
+	}
+
+	void sThreadCacheFree(MemBlock inMemory)
+	{
+		if (inMemory.mSize > cMaxCachedSize)
+		{
+			free(inMemory.mPtr);
+			return;
+		}
+
+		int          size_class = sGetSizeClass(inMemory.mSize);
+		ThreadCache& cache      = sThreadCache;
+
+		FreeObject* object = (FreeObject*)inMemory.mPtr;
+		object->mNext      = cache.mFreeLists[size_class];
+
+		cache.mFreeLists[size_class] = object;
+		cache.mFreeCounts[size_class]++;
+
+		// Flush a batch back to the central cache if this thread is holding too many.
+		if (cache.mFreeCounts[size_class] > cMaxPerClassCount) [[unlikely]]
+		{
+			FreeObject* chain_head = cache.mFreeLists[size_class];
+			FreeObject* chain_tail = chain_head;
+
+			for (int i = 1; i < cBatchSize; i++)
+				chain_tail = chain_tail->mNext;
+
+			cache.mFreeLists[size_class]  = chain_tail->mNext;
+			cache.mFreeCounts[size_class] -= cBatchSize;
+			chain_tail->mNext             = nullptr;
+
+			sCentralCache.PushBatch(size_class, chain_head, cBatchSize);
+		}
+	}
+}
+
+#endif // MEM_THREAD_CACHE_ENABLED
+
 
 MemBlock gMemAlloc(int64 inSize)
 {
+#if MEM_THREAD_CACHE_ENABLED
+	MemBlock memory = { sThreadCacheAlloc(inSize), inSize };
+#else
 	MemBlock memory = { (uint8*)malloc(inSize), inSize };
+#endif
 
 #ifdef TESTS_ENABLED
-	if (gIsRunningTest()) 
+	if (gIsRunningTest())
 		gRegisterAlloc(memory);
 #endif
 
+	if (Details::gMemProfilerEnabled) [[unlikely]]
+		Details::MemProfilerRegisterAlloc(memory, BEDROCK_RETURN_ADDRESS());
+
 	return memory;
 }
 
@@ -24,11 +223,18 @@ void gMemFree(MemBlock inMemory)
 	gAssert(inMemory.mSize > 0);
 
 #ifdef TESTS_ENABLED
-	if (gIsRunningTest()) 
+	if (gIsRunningTest())
 		gRegisterFree(inMemory);
 #endif
 
+	if (Details::gMemProfilerEnabled) [[unlikely]]
+		Details::MemProfilerRegisterFree(inMemory);
+
+#if MEM_THREAD_CACHE_ENABLED
+	sThreadCacheFree(inMemory);
+#else
 	free(inMemory.mPtr);
+#endif
 }
 
 
@@ -77,6 +283,26 @@ MemBlock gVMemReserve(int64 inSize)
 }
 
 
+MemBlock gVMemReserveNuma(int64 inSize, int inNumaNode)
+{
+	gAssert(inNumaNode >= 0 && inNumaNode < gGetNumaNodeCount());
+
+	inSize = gAlignUp(inSize, gVMemReserveGranularity());
+
+	// The node preference is stored with the reservation; the OS uses it when the committed pages
+	// are first touched, so committing later with gVMemCommit keeps the pages node-local.
+	void* ptr = VirtualAllocExNuma(GetCurrentProcess(), nullptr, inSize, MEM_RESERVE, PAGE_NOACCESS, inNumaNode);
+
+	if (ptr == nullptr) [[unlikely]]
+	{
+		gAssert(false);
+		return {};
+	}
+
+	return { (uint8*)ptr, inSize };
+}
+
+
 void gVMemFree(MemBlock inBlock)
 {
 	BOOL success = VirtualFree(inBlock.mPtr, 0, MEM_RELEASE);
@@ -84,6 +310,63 @@ void gVMemFree(MemBlock inBlock)
 }
 
 
+int gVMemLargePageSize()
+{
+	static const int sLargePageSize = (int)GetLargePageMinimum();
+	return sLargePageSize;
+}
+
+
+// Using large pages requires SeLockMemoryPrivilege. Holding it is a machine configuration matter
+// (Local Security Policy), but it still needs to be enabled in the process token once.
+static bool sEnableLockMemoryPrivilege()
+{
+	static const bool sEnabled = []()
+	{
+		HANDLE token;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+			return false;
+
+		TOKEN_PRIVILEGES privileges      = {};
+		privileges.PrivilegeCount        = 1;
+		privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+		if (!LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid))
+		{
+			CloseHandle(token);
+			return false;
+		}
+
+		BOOL adjusted = AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr);
+		// Note: AdjustTokenPrivileges returns TRUE even when the privilege was not granted.
+		bool success  = adjusted && GetLastError() == ERROR_SUCCESS;
+
+		CloseHandle(token);
+		return success;
+	}();
+
+	return sEnabled;
+}
+
+
+MemBlock gVMemReserveLargePages(int64 inSize)
+{
+	int64 large_page_size = gVMemLargePageSize();
+	if (large_page_size == 0 || !sEnableLockMemoryPrivilege())
+		return {}; // Large pages not supported or not allowed.
+
+	inSize = gAlignUp(inSize, large_page_size);
+
+	// Large pages cannot be committed lazily, the entire block is committed upfront.
+	void* ptr = VirtualAlloc(nullptr, inSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+	if (ptr == nullptr)
+		return {}; // Can fail even with the privilege if physical memory is too fragmented.
+
+	return { (uint8*)ptr, inSize };
+}
+
+
 MemBlock gVMemCommit(MemBlock inBlock)
 {
 	int64 begin = (int64)inBlock.mPtr;
@@ -106,4 +389,224 @@ MemBlock gVMemCommit(MemBlock inBlock)
 	}
 
 	return inBlock;
-}
\ No newline at end of file
+}
+
+
+namespace
+{
+	// Below this size the data likely fits in cache and is about to be reused; regular stores win.
+	// Above it the writes would just evict the entire cache for nothing, so stream instead.
+	constexpr int64 cNonTemporalThreshold = 2_MiB;
+}
+
+
+void gMemSetNonTemporal(void* inDest, uint8 inValue, int64 inSize)
+{
+	if (inSize < cNonTemporalThreshold)
+	{
+		gMemSet(inDest, inValue, (int)inSize);
+		return;
+	}
+
+	uint8*        dest  = (uint8*)inDest;
+	uint8*        end   = dest + inSize;
+	const __m128i value = _mm_set1_epi8((char)inValue);
+
+	// Fill the (potentially unaligned) first 16 bytes, then continue from the next aligned address.
+	// The two ranges overlap when dest isn't aligned; that's fine, the value is the same.
+	_mm_storeu_si128((__m128i*)dest, value);
+	uint8* aligned = (uint8*)gAlignDown((int64)dest + 16, 16);
+
+	while (aligned + 64 <= end)
+	{
+		_mm_stream_si128((__m128i*)(aligned + 0),  value);
+		_mm_stream_si128((__m128i*)(aligned + 16), value);
+		_mm_stream_si128((__m128i*)(aligned + 32), value);
+		_mm_stream_si128((__m128i*)(aligned + 48), value);
+		aligned += 64;
+	}
+
+	while (aligned + 16 <= end)
+	{
+		_mm_stream_si128((__m128i*)aligned, value);
+		aligned += 16;
+	}
+
+	// Fill the (potentially unaligned) last 16 bytes, overlapping the streamed range if needed.
+	_mm_storeu_si128((__m128i*)(end - 16), value);
+
+	// Streaming stores are weakly ordered; fence so they are visible to other threads before any
+	// store that follows (eg. publishing a pointer to the filled buffer).
+	_mm_sfence();
+}
+
+
+void gMemCopyNonTemporal(void* inDest, const void* inSource, int64 inSize)
+{
+	gAssert((uint8*)inDest + inSize <= (const uint8*)inSource || (const uint8*)inSource + inSize <= (uint8*)inDest); // No overlap.
+
+	if (inSize < cNonTemporalThreshold)
+	{
+		gMemCopy(inDest, inSource, (int)inSize);
+		return;
+	}
+
+	uint8*       dest   = (uint8*)inDest;
+	const uint8* source = (const uint8*)inSource;
+	uint8*       end    = dest + inSize;
+
+	// Copy the (potentially unaligned) first 16 bytes, then continue from the next aligned address.
+	// Only the stores need to be aligned to stream, the loads can stay unaligned.
+	_mm_storeu_si128((__m128i*)dest, _mm_loadu_si128((const __m128i*)source));
+	uint8* aligned = (uint8*)gAlignDown((int64)dest + 16, 16);
+	source += aligned - dest;
+
+	while (aligned + 64 <= end)
+	{
+		__m128i value0 = _mm_loadu_si128((const __m128i*)(source + 0));
+		__m128i value1 = _mm_loadu_si128((const __m128i*)(source + 16));
+		__m128i value2 = _mm_loadu_si128((const __m128i*)(source + 32));
+		__m128i value3 = _mm_loadu_si128((const __m128i*)(source + 48));
+		_mm_stream_si128((__m128i*)(aligned + 0),  value0);
+		_mm_stream_si128((__m128i*)(aligned + 16), value1);
+		_mm_stream_si128((__m128i*)(aligned + 32), value2);
+		_mm_stream_si128((__m128i*)(aligned + 48), value3);
+		aligned += 64;
+		source  += 64;
+	}
+
+	while (aligned + 16 <= end)
+	{
+		_mm_stream_si128((__m128i*)aligned, _mm_loadu_si128((const __m128i*)source));
+		aligned += 16;
+		source  += 16;
+	}
+
+	// Copy the (potentially unaligned) last 16 bytes, overlapping the streamed range if needed.
+	_mm_storeu_si128((__m128i*)(end - 16), _mm_loadu_si128((const __m128i*)((const uint8*)inSource + inSize - 16)));
+
+	_mm_sfence();
+}
+
+
+REGISTER_TEST("VMemNuma")
+{
+	// Reserve on every node, commit, touch, free.
+	for (int node = 0; node < gGetNumaNodeCount(); node++)
+	{
+		MemBlock reserved = gVMemReserveNuma(100_KiB, node);
+		TEST_TRUE(reserved != nullptr);
+
+		MemBlock committed = gVMemCommit({ reserved.mPtr, 10_KiB });
+		TEST_TRUE(committed != nullptr);
+		committed.mPtr[0]                   = 1;
+		committed.mPtr[committed.mSize - 1] = 1;
+
+		gVMemFree(reserved);
+	}
+};
+
+
+REGISTER_TEST("MemThreadCache")
+{
+	// Allocate and free blocks of every size class, plus some above the cached sizes.
+	MemBlock blocks[64];
+	for (int i = 0; i < 64; i++)
+	{
+		blocks[i] = gMemAlloc(i * 5 + 1);
+		TEST_TRUE(blocks[i] != nullptr);
+
+		// Write to the whole block.
+		for (int j = 0; j < blocks[i].mSize; j++)
+			blocks[i].mPtr[j] = (uint8)i;
+	}
+
+	for (int i = 0; i < 64; i++)
+	{
+		TEST_TRUE(blocks[i].mPtr[0] == (uint8)i);
+		gMemFree(blocks[i]);
+	}
+
+#if MEM_THREAD_CACHE_ENABLED
+	// With the cache enabled, a freed block is recycled immediately (LIFO).
+	MemBlock recycled = gMemAlloc(100);
+	gMemFree(recycled);
+	MemBlock recycled2 = gMemAlloc(100);
+	TEST_TRUE(recycled2.mPtr == recycled.mPtr);
+	gMemFree(recycled2);
+
+	// Churning more than the per-thread limit forces batches through the central cache.
+	// Each thread allocates and frees only its own blocks (the test leak tracking is per-thread).
+	auto churn = [](Thread&)
+	{
+		MemBlock thread_blocks[200];
+
+		for (int round = 0; round < 3; round++)
+		{
+			for (MemBlock& block : thread_blocks)
+			{
+				block = gMemAlloc(64);
+				block.mPtr[0] = 1;
+			}
+
+			for (MemBlock& block : thread_blocks)
+				gMemFree(block);
+		}
+	};
+
+	Thread threads[4];
+	for (Thread& thread : threads)
+		thread.Create({}, churn);
+
+	for (Thread& thread : threads)
+		thread.Join();
+#endif
+};
+
+
+REGISTER_TEST("MemNonTemporal")
+{
+	// Large enough to take the streaming path, plus margin to test unaligned starts and ends.
+	constexpr int64 cBufferSize = 3_MiB;
+
+	MemBlock dest      = gMemAlloc(cBufferSize);
+	MemBlock source    = gMemAlloc(cBufferSize);
+	MemBlock reference = gMemAlloc(cBufferSize);
+
+	int rand_seed = 42;
+	for (int64 i = 0; i < cBufferSize; i++)
+	{
+		rand_seed       = gRand32(rand_seed);
+		source.mPtr[i]  = (uint8)rand_seed;
+	}
+
+	// Try a few start offsets and sizes so both the aligned and unaligned head/tail paths run,
+	// in both the small (regular stores) and large (streaming stores) regimes.
+	constexpr int64 cOffsets[] = { 0, 1, 7, 16, 33 };
+	constexpr int64 cSizes[]   = { 100, 4096, cBufferSize - 64 };
+
+	for (int64 offset : cOffsets)
+		for (int64 size : cSizes)
+		{
+			gMemSet(dest.mPtr, 0xCD, (int)cBufferSize);
+			gMemSetNonTemporal(dest.mPtr + offset, 0xAB, size);
+
+			bool fill_correct = true;
+			for (int64 i = 0; i < size; i++)
+				fill_correct = fill_correct && (dest.mPtr[offset + i] == 0xAB);
+			TEST_TRUE(fill_correct);
+			TEST_TRUE(offset == 0 || dest.mPtr[offset - 1] == 0xCD); // No write before the range.
+			TEST_TRUE(dest.mPtr[offset + size] == 0xCD);             // No write past the range.
+
+			gMemSet(dest.mPtr, 0xCD, (int)cBufferSize);
+			gMemSet(reference.mPtr, 0xCD, (int)cBufferSize);
+			gMemCopyNonTemporal(dest.mPtr + offset, source.mPtr + 3, size);
+			gMemCopy(reference.mPtr + offset, source.mPtr + 3, (int)size);
+
+			TEST_TRUE(gMemCmp(dest.mPtr, reference.mPtr, (int)cBufferSize) == 0);
+		}
+
+	gMemFree(reference);
+	gMemFree(source);
+	gMemFree(dest);
+};
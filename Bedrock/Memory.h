@@ -28,5 +28,26 @@ MemBlock gVMemCommit(MemBlock inMemory); // Commit some reserved memory.
 										 // On success, return the committed MemBlock (inMemory rounded up/down to commit granularity).
 										 // On failure, return a nullptr MemBlock.
 
+MemBlock gVMemReserveNuma(int64 inSize, int inNumaNode); // Reserve some memory with a preferred NUMA node. Behaves like gVMemReserve otherwise
+														 // (commit with gVMemCommit, free with gVMemFree). The preference is remembered by the OS
+														 // and used when the committed pages are first touched.
+
+// Bulk Fill/Copy
+//
+// Same as gMemSet/gMemCopy but switch to non-temporal (streaming) stores above a size threshold:
+// the written data goes straight to memory instead of evicting the entire cache, which is what you
+// want for buffers much larger than the cache that won't be read back soon (eg. zeroing a freshly
+// resized multi-MB Vector). Below the threshold they fall back to the regular versions, so they
+// are safe to call for any size. Like gMemCopy, gMemCopyNonTemporal doesn't support overlap.
+
+void gMemSetNonTemporal(void* inDest, uint8 inValue, int64 inSize);
+void gMemCopyNonTemporal(void* inDest, const void* inSource, int64 inSize);
+
+
+int      gVMemLargePageSize();               // Return the large page size, or 0 if large pages aren't supported.
+MemBlock gVMemReserveLargePages(int64 inSize); // Reserve AND commit memory backed by large pages. inSize will be rounded up to the large page size.
+											   // Large pages cannot be committed lazily. Free with gVMemFree.
+											   // On failure (no privilege, fragmented physical memory), return a nullptr MemBlock.
+
 
 
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/MemoryArena.h>
+#include <Bedrock/Algorithm.h>
 #include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
 
 
 
@@ -41,3 +43,88 @@ REGISTER_TEST("MemArena")
 	TEST_TRUE(arena.GetAllocatedSize() == 0);
 	TEST_TRUE(arena.GetNumPendingFree() == 0);
 };
+
+
+REGISTER_TEST("VMemArena LargePages")
+{
+	// Large pages need SeLockMemoryPrivilege, which is usually not granted; the arena must then
+	// transparently fall back to regular pages. Either way it has to behave the same.
+	VMemArena arena(8_MiB, 1_MiB, EVMemLargePages::Yes);
+
+	MemBlock b1 = arena.Alloc(100);
+	TEST_TRUE(b1 != nullptr);
+	b1.mPtr[0] = 1; // Make sure writing to it doesn't crash.
+	b1.mPtr[99] = 1;
+
+	MemBlock b2 = arena.Alloc(1_MiB);
+	TEST_TRUE(b2 != nullptr);
+	b2.mPtr[1_MiB - 1] = 1;
+
+	arena.Free(b2);
+	arena.Free(b1);
+	TEST_TRUE(arena.GetAllocatedSize() == 0);
+};
+
+
+REGISTER_TEST("AtomicMemArena")
+{
+	constexpr int cAlignment = AtomicMemArena::cAlignment;
+	alignas(cAlignment) uint8 buffer[cAlignment * 4];
+	AtomicMemArena arena({ buffer, sizeof(buffer) });
+
+	MemBlock b1 = arena.Alloc(1);
+	TEST_TRUE(b1 != nullptr);
+	MemBlock b2 = arena.Alloc(cAlignment * 2);
+	TEST_TRUE(b2 != nullptr);
+	TEST_TRUE(arena.GetAllocatedSize() == cAlignment * 3);
+
+	// Doesn't fit, but must not prevent a smaller alloc from succeeding afterwards.
+	TEST_TRUE(arena.Alloc(cAlignment * 2) == nullptr);
+	MemBlock b3 = arena.Alloc(1);
+	TEST_TRUE(b3 != nullptr);
+
+	// Free doesn't reclaim anything, only Reset does.
+	arena.Free(b3);
+	arena.Free(b2);
+	arena.Free(b1);
+	TEST_TRUE(arena.GetAllocatedSize() == cAlignment * 4);
+
+	arena.Reset();
+	TEST_TRUE(arena.GetAllocatedSize() == 0);
+
+	// Fill the arena from several threads; all allocations must be distinct.
+	constexpr int cNumThreads         = 4;
+	constexpr int cAllocsPerThread    = 16;
+	alignas(cAlignment) uint8 large_buffer[cAlignment * cNumThreads * cAllocsPerThread];
+	AtomicMemArena large_arena({ large_buffer, sizeof(large_buffer) });
+
+	uint8* alloc_ptrs[cNumThreads * cAllocsPerThread] = {};
+
+	Thread threads[cNumThreads];
+	for (int i = 0; i < cNumThreads; i++)
+	{
+		threads[i].Create({}, [&large_arena, &alloc_ptrs, i](Thread&)
+		{
+			for (int j = 0; j < cAllocsPerThread; j++)
+			{
+				MemBlock mem = large_arena.Alloc(1);
+				alloc_ptrs[i * cAllocsPerThread + j] = mem.mPtr;
+			}
+		});
+	}
+
+	for (Thread& thread : threads)
+		thread.Join();
+
+	TEST_TRUE(large_arena.GetAllocatedSize() == (int)sizeof(large_buffer));
+	TEST_TRUE(large_arena.Alloc(1) == nullptr);
+
+	// Check that no two allocations overlap (every pointer is distinct and aligned).
+	gSort(alloc_ptrs, alloc_ptrs + cNumThreads * cAllocsPerThread);
+	for (int i = 0; i < cNumThreads * cAllocsPerThread; i++)
+	{
+		TEST_TRUE(alloc_ptrs[i] == large_buffer + i * cAlignment);
+	}
+
+	large_arena.Reset();
+};
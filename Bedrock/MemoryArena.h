@@ -3,6 +3,7 @@
 
 #include <Bedrock/Core.h>
 #include <Bedrock/Memory.h>
+#include <Bedrock/Atomic.h>
 
 namespace Details
 {
@@ -18,6 +19,7 @@ namespace Details
 	{
 		no_inline    void AddPendingFree(FreeBlock inFreeBlock);
 		no_inline    void TryRemovePendingFree(int& ioCurrentOffset);
+		no_inline    void RemovePendingFreesAfter(int inOffset);
 		force_inline int  GetNumPendingFree() const { return mCount; }
 
 		int       mCount = 0;				
@@ -29,6 +31,7 @@ namespace Details
 	{
 		force_inline static void AddPendingFree(FreeBlock inFreeBlock)		{ CRASH; }
 		force_inline static void TryRemovePendingFree(int& ioCurrentOffset)	{}
+		force_inline static void RemovePendingFreesAfter(int inOffset)		{}
 		force_inline static int  GetNumPendingFree()						{ return 0; }
 	}; 
 }
@@ -64,11 +67,13 @@ struct MemArena : Details::PendingFreeArray<taMaxPendingFrees>
 		mBeginPtr        = ioOther.mBeginPtr;
 		mEndOffset       = ioOther.mEndOffset;
 		mCurrentOffset   = ioOther.mCurrentOffset;
+		mPeakOffset      = ioOther.mPeakOffset;
 		Base::operator=((Base&&)ioOther);
 
 		ioOther.mBeginPtr        = nullptr;
 		ioOther.mEndOffset       = 0;
 		ioOther.mCurrentOffset   = 0;
+		ioOther.mPeakOffset      = 0;
 		ioOther.Base::operator=({});
 
 		return *this;
@@ -104,6 +109,7 @@ struct MemArena : Details::PendingFreeArray<taMaxPendingFrees>
 			return {}; // Allocation failed.
 
 		mCurrentOffset += aligned_size;
+		mPeakOffset     = gMax(mPeakOffset, mCurrentOffset);
 
 		return { mBeginPtr + current_offset, inSize };
 	}
@@ -149,6 +155,7 @@ struct MemArena : Details::PendingFreeArray<taMaxPendingFrees>
 			return false; // Wouldn't fit.
 
 		mCurrentOffset = new_current_offset;
+		mPeakOffset    = gMax(mPeakOffset, mCurrentOffset);
 		ioMemory.mSize = inNewSize;
 
 		return true;
@@ -172,15 +179,125 @@ struct MemArena : Details::PendingFreeArray<taMaxPendingFrees>
 		return mCurrentOffset;
 	}
 
+	// Return the highest amount of memory that was ever allocated at the same time.
+	int GetPeakAllocatedSize() const
+	{
+		return mPeakOffset;
+	}
+
+	// Rewind the arena to a previously captured allocated size, dropping everything allocated
+	// since (see TempMemScope). The caller is responsible for making sure none of it is still
+	// referenced.
+	void Rewind(int inAllocatedSize)
+	{
+		gAssert(inAllocatedSize >= 0 && inAllocatedSize <= mCurrentOffset);
+
+		// Drop the pending out-of-order frees inside the rewound region.
+		RemovePendingFreesAfter(inAllocatedSize);
+		mCurrentOffset = inAllocatedSize;
+
+		// Allocations below the rewind point may have been freed out of order in the meantime.
+		if (GetNumPendingFree() > 0) [[unlikely]]
+			TryRemovePendingFree(mCurrentOffset);
+	}
+
 	using Base::GetNumPendingFree;
 
 protected:
 	uint8* mBeginPtr      = nullptr;
 	int    mEndOffset     = 0;
 	int    mCurrentOffset = 0;
-	
+	int    mPeakOffset    = 0;
+
 	using Base::AddPendingFree;
 	using Base::TryRemovePendingFree;
+	using Base::RemovePendingFreesAfter;
+};
+
+
+// Thread-safe version of MemArena. Alloc is a single atomic add on the offset, so any number of
+// threads can fill the same arena with no contention beyond that add (eg. parallel loaders during
+// a fan-out/join phase). In exchange, individual frees don't reclaim memory: everything is
+// reclaimed at once with Reset, once no thread is allocating anymore.
+// Usable as the backing arena of an ArenaAllocator (eg. Vector<T, ArenaAllocator<T, AtomicMemArena>>).
+struct AtomicMemArena : NoCopy
+{
+	static constexpr int cAlignment = 16;
+
+	AtomicMemArena() = default;
+	~AtomicMemArena() { gAssert(GetAllocatedSize() == 0); } // Reset must be called before destruction.
+
+	// Initialize this arena with a memory block.
+	AtomicMemArena(MemBlock inMemory)
+	{
+		gAssert(((uint64)inMemory.mPtr % cAlignment) == 0);	// Pointer should be aligned.
+		gAssert((inMemory.mSize % cAlignment) == 0);		// Size should be aligned.
+
+		mBeginPtr  = inMemory.mPtr;
+		mEndOffset = (int)inMemory.mSize;
+	}
+
+	// Get this arena's entire memory block.
+	MemBlock GetMemBlock() const
+	{
+		return { mBeginPtr, mEndOffset };
+	}
+
+	// Allocate memory. Safe to call from any thread.
+	MemBlock Alloc(int inSize)
+	{
+		gAssert(mBeginPtr != nullptr); // Need to initialize with a MemBlock first.
+
+		int aligned_size = (int)gAlignUp(inSize, cAlignment);
+		int offset       = mCurrentOffset.Add(aligned_size);
+
+		if (offset + aligned_size > mEndOffset) [[unlikely]]
+		{
+			// Doesn't fit. Give the size back so smaller allocations can still succeed.
+			mCurrentOffset.Sub(aligned_size);
+			return {}; // Allocation failed.
+		}
+
+		return { mBeginPtr + offset, inSize };
+	}
+
+	// Free memory. The memory is not actually reclaimed until Reset is called.
+	void Free(MemBlock inMemory)
+	{
+		gAssert(inMemory.mPtr != nullptr);
+		gAssert(Owns(inMemory.mPtr));
+	}
+
+	// Resizing is not supported since another thread may have allocated right after ioMemory.
+	bool TryRealloc(MemBlock& ioMemory, int inNewSize)
+	{
+		gAssert(Owns(ioMemory.mPtr));
+		return false;
+	}
+
+	// Reclaim all the memory at once. Not safe to call while other threads are allocating.
+	void Reset()
+	{
+		mCurrentOffset.Store(0);
+	}
+
+	// Return true if inMemoryPtr is inside this arena.
+	bool Owns(const void* inMemoryPtr) const
+	{
+		return ((const uint8*)inMemoryPtr >= mBeginPtr && (const uint8*)inMemoryPtr < (mBeginPtr + mEndOffset));
+	}
+
+	// Return the amount of memory currently allocated.
+	int GetAllocatedSize() const
+	{
+		// Note: A failed Alloc can transiently push the offset past the end, clamp it.
+		return gMin((int)mCurrentOffset.Load(), mEndOffset);
+	}
+
+private:
+	uint8*		mBeginPtr  = nullptr;
+	int			mEndOffset = 0;
+	AtomicInt32	mCurrentOffset = 0;
 };
 
 
@@ -202,6 +319,18 @@ private:
 };
 
 
+// Whether a VMemArena should be backed by large/huge pages.
+// Large pages reduce dTLB misses for big resident datasets, but the entire arena is committed
+// upfront (large pages cannot be committed lazily), the process needs SeLockMemoryPrivilege, and
+// the allocation can fail if physical memory is fragmented (the arena then falls back to regular
+// pages).
+enum class EVMemLargePages
+{
+	No,
+	Yes
+};
+
+
 // Version of MemArena that allocates virtual memory as backing. Can grow.
 template <int taMaxPendingFrees = cDefaultMaxPendingFrees>
 struct VMemArena : MemArena<taMaxPendingFrees>
@@ -214,8 +343,9 @@ struct VMemArena : MemArena<taMaxPendingFrees>
 	VMemArena() = default;
 	~VMemArena() { FreeReserved(); }
 
-	// Initialize this arena with reserved memory (but no committed memory yet). 
-	VMemArena(int64 inReservedSize, int64 inCommitIncreaseSize)
+	// Initialize this arena with reserved memory (but no committed memory yet, unless large pages are used).
+	// inCommitIncreaseSize is the commit-ahead size: how much gets committed every time the arena grows.
+	VMemArena(int64 inReservedSize, int64 inCommitIncreaseSize, EVMemLargePages inLargePages = EVMemLargePages::No)
 	{
 		// Replace parameters by defaults if necessary.
 		if (inReservedSize <= 0)
@@ -223,6 +353,22 @@ struct VMemArena : MemArena<taMaxPendingFrees>
 		if (inCommitIncreaseSize <= 0)
 			inCommitIncreaseSize = cDefaultCommitSize;
 
+		if (inLargePages == EVMemLargePages::Yes)
+		{
+			MemBlock large_page_mem = gVMemReserveLargePages(inReservedSize);
+
+			if (large_page_mem != nullptr)
+			{
+				// The entire block is already committed, initialize the parent MemArena with all of it.
+				mLargePages        = true;
+				mEndReservedOffset = (int)large_page_mem.mSize;
+				Base::operator=(MemBlock{ large_page_mem.mPtr, large_page_mem.mSize });
+				return;
+			}
+
+			// Large pages unavailable (privilege or fragmentation), fall back to regular pages.
+		}
+
 		mCommitIncreaseSize = (int)gAlignUp(inCommitIncreaseSize, gVMemCommitGranularity());
 
 		// Reserve the memory.
@@ -242,8 +388,10 @@ struct VMemArena : MemArena<taMaxPendingFrees>
 
 		mCommitIncreaseSize         = ioOther.mCommitIncreaseSize;
 		mEndReservedOffset          = ioOther.mEndReservedOffset;
+		mLargePages                 = ioOther.mLargePages;
 		ioOther.mEndReservedOffset  = 0;
 		ioOther.mCommitIncreaseSize = 0;
+		ioOther.mLargePages         = false;
 
 		return *this;
 	}
@@ -259,7 +407,8 @@ struct VMemArena : MemArena<taMaxPendingFrees>
 		int new_current_offset = mCurrentOffset + aligned_size;
 
 		// Check if we need to commit more memory.
-		if (new_current_offset > mEndOffset) [[unlikely]]
+		// Note: With large pages everything is committed upfront, there is nothing more to commit.
+		if (new_current_offset > mEndOffset && !mLargePages) [[unlikely]]
 			CommitMore(new_current_offset);
 
 		return Base::Alloc(inSize);
@@ -274,7 +423,8 @@ struct VMemArena : MemArena<taMaxPendingFrees>
 		int new_current_offset = (int)(ioMemory.mPtr + aligned_new_size - mBeginPtr);
 
 		// Check if we need to commit more memory.
-		if (new_current_offset > mEndOffset) [[unlikely]]
+		// Note: With large pages everything is committed upfront, there is nothing more to commit.
+		if (new_current_offset > mEndOffset && !mLargePages) [[unlikely]]
 			CommitMore(new_current_offset);
 
 		return Base::TryRealloc(ioMemory, inNewSize);
@@ -293,8 +443,9 @@ private:
 	using Base::mCurrentOffset;
 	using Base::mEndOffset;
 
-	int mEndReservedOffset  = 0;
-	int mCommitIncreaseSize = 64_KiB;
+	int  mEndReservedOffset  = 0;
+	int  mCommitIncreaseSize = 64_KiB;
+	bool mLargePages         = false;
 };
 
 
@@ -380,6 +531,18 @@ void Details::PendingFreeArray<taSize>::TryRemovePendingFree(int& ioCurrentOffse
 }
 
 
+template <int taSize>
+void Details::PendingFreeArray<taSize>::RemovePendingFreesAfter(int inOffset)
+{
+	// Blocks are sorted by offset, drop from the back.
+	while (mCount > 0 && mBlocks[mCount - 1].BeginOffset() >= inOffset)
+		mCount--;
+
+	// A pending free cannot straddle the rewind point since that point was an allocation boundary.
+	gAssert(mCount == 0 || mBlocks[mCount - 1].mEndOffset <= inOffset);
+}
+
+
 template <int taMaxPendingFrees>
 void VMemArena<taMaxPendingFrees>::CommitMore(int inNewEndOffset)
 {
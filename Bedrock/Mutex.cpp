@@ -2,6 +2,7 @@
 #include <Bedrock/Mutex.h>
 #include <Bedrock/Test.h>
 #include <Bedrock/Move.h>
+#include <Bedrock/Thread.h>
 
 #define VC_EXTRALEAN
 #define WIN32_LEAN_AND_MEAN
@@ -11,7 +12,16 @@
 
 Mutex::Mutex()
 {
-	InitializeSRWLock((PSRWLOCK)&mOSMutex); 
+	InitializeSRWLock((PSRWLOCK)&mOSMutex);
+}
+
+
+Mutex::Mutex(int inSpinCount)
+	: mSpinCount(inSpinCount)
+{
+	gAssert(inSpinCount >= 0);
+
+	InitializeSRWLock((PSRWLOCK)&mOSMutex);
 }
 
 
@@ -20,6 +30,35 @@ Mutex::~Mutex()
 }
 
 
+// Retry acquiring the lock inSpinCount times before giving up, pausing an exponentially growing
+// number of cycles between attempts so spinners don't hammer the cache line the lock lives on.
+static bool sTryLockSpinning(PSRWLOCK ioLock, int inSpinCount)
+{
+	constexpr int cMaxBackoff = 64;
+	int           backoff     = 1;
+
+	for (int spin = 0; spin < inSpinCount; spin++)
+	{
+		if (TryAcquireSRWLockExclusive(ioLock))
+			return true;
+
+		if (backoff < cMaxBackoff)
+		{
+			for (int i = 0; i < backoff; i++)
+				YieldProcessor();
+			backoff *= 2;
+		}
+		else
+		{
+			// Backoff is maxed out, the owner is probably not running; let other threads run instead.
+			gYieldThread();
+		}
+	}
+
+	return false;
+}
+
+
 void Mutex::Lock()
 {
 #ifdef ASSERTS_ENABLED
@@ -27,7 +66,8 @@ void Mutex::Lock()
 	gAssert(mLockingThreadID != current_thread_id); // Recursive locking is not allowed.
 #endif
 
-	AcquireSRWLockExclusive((PSRWLOCK)&mOSMutex);
+	if (mSpinCount == 0 || !sTryLockSpinning((PSRWLOCK)&mOSMutex, mSpinCount))
+		AcquireSRWLockExclusive((PSRWLOCK)&mOSMutex);
 
 #ifdef ASSERTS_ENABLED
 	mLockingThreadID = current_thread_id;
@@ -47,6 +87,61 @@ void Mutex::Unlock()
 
 
 
+SharedMutex::SharedMutex()
+{
+	InitializeSRWLock((PSRWLOCK)&mOSMutex);
+}
+
+
+SharedMutex::~SharedMutex()
+{
+}
+
+
+void SharedMutex::Lock()
+{
+#ifdef ASSERTS_ENABLED
+	uint32 current_thread_id = GetCurrentThreadId();
+	gAssert(mLockingThreadID != current_thread_id); // Recursive locking is not allowed.
+#endif
+
+	AcquireSRWLockExclusive((PSRWLOCK)&mOSMutex);
+
+#ifdef ASSERTS_ENABLED
+	mLockingThreadID = current_thread_id;
+#endif
+}
+
+
+void SharedMutex::Unlock()
+{
+#ifdef ASSERTS_ENABLED
+	gAssert(mLockingThreadID == GetCurrentThreadId());
+	mLockingThreadID = cInvalidThreadID;
+#endif
+
+	ReleaseSRWLockExclusive((PSRWLOCK)&mOSMutex);
+}
+
+
+void SharedMutex::LockShared()
+{
+#ifdef ASSERTS_ENABLED
+	// Taking the shared lock while holding the exclusive lock would deadlock.
+	gAssert(mLockingThreadID != GetCurrentThreadId());
+#endif
+
+	AcquireSRWLockShared((PSRWLOCK)&mOSMutex);
+}
+
+
+void SharedMutex::UnlockShared()
+{
+	ReleaseSRWLockShared((PSRWLOCK)&mOSMutex);
+}
+
+
+
 REGISTER_TEST("Mutex")
 {
 	Mutex mutex;
@@ -62,3 +157,66 @@ REGISTER_TEST("Mutex")
 		other_lock = gMove(lock);
 	}
 };
+
+
+REGISTER_TEST("Mutex Spin")
+{
+	Mutex mutex(Mutex::cDefaultSpinCount);
+
+	mutex.Lock();
+	mutex.Unlock();
+
+	// Hammer the mutex from several threads; the count must come out exact.
+	constexpr int cNumThreads          = 4;
+	constexpr int cIncrementsPerThread = 10000;
+	int           counter              = 0;
+
+	Thread threads[cNumThreads];
+	for (Thread& thread : threads)
+	{
+		thread.Create({}, [&mutex, &counter](Thread&)
+		{
+			for (int i = 0; i < cIncrementsPerThread; i++)
+			{
+				LockGuard lock(mutex);
+				counter++;
+			}
+		});
+	}
+
+	for (Thread& thread : threads)
+		thread.Join();
+
+	TEST_TRUE(counter == cNumThreads * cIncrementsPerThread);
+};
+
+
+REGISTER_TEST("SharedMutex")
+{
+	SharedMutex mutex;
+
+	mutex.Lock();
+	mutex.Unlock();
+
+	mutex.LockShared();
+	mutex.UnlockShared();
+
+	{
+		SharedLockGuard lock(mutex);
+
+		// Another thread can hold the shared lock at the same time.
+		Thread reader;
+		reader.Create({}, [&mutex](Thread&)
+		{
+			SharedLockGuard other_lock(mutex);
+		});
+		reader.Join();
+
+		SharedLockGuard<SharedMutex> moved_lock;
+		moved_lock = gMove(lock);
+	}
+
+	{
+		LockGuard lock(mutex);
+	}
+};
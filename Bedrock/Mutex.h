@@ -11,9 +11,17 @@ using OSThread = void*;
 
 struct Mutex : NoCopy
 {
+	// Good spin count for mutexes protecting very short critical sections.
+	static constexpr int cDefaultSpinCount = 64;
+
 	Mutex();
 	~Mutex();
 
+	// A non-zero spin count makes Lock retry that many times in user space (with exponential
+	// backoff) before parking in the kernel. The park/unpark round trip costs microseconds, so
+	// spinning wins when the critical section is only a few tens of nanoseconds long.
+	explicit Mutex(int inSpinCount);
+
 	void Lock();
 	void Unlock();
 
@@ -21,6 +29,7 @@ private:
 	static constexpr uint32 cInvalidThreadID = 0;
 
 	OSMutex  mOSMutex         = nullptr;
+	int      mSpinCount       = 0;
 #ifdef ASSERTS_ENABLED
 	uint32   mLockingThreadID = cInvalidThreadID;
 #endif
@@ -29,6 +38,33 @@ private:
 };
 
 
+// Reader-writer mutex for read-mostly data.
+// Many threads can hold the shared lock at the same time, only one can hold the exclusive lock.
+// Built on the OS slim reader-writer lock, so uncontended LockShared/UnlockShared are a single
+// interlocked operation and writers are preferred over new readers once they start waiting.
+struct SharedMutex : NoCopy
+{
+	SharedMutex();
+	~SharedMutex();
+
+	// Exclusive (writer) lock.
+	void Lock();
+	void Unlock();
+
+	// Shared (reader) lock.
+	void LockShared();
+	void UnlockShared();
+
+private:
+	static constexpr uint32 cInvalidThreadID = 0;
+
+	OSMutex  mOSMutex         = nullptr;
+#ifdef ASSERTS_ENABLED
+	uint32   mLockingThreadID = cInvalidThreadID;
+#endif
+};
+
+
 template <typename taMutex>
 struct LockGuard : NoCopy
 {
@@ -68,4 +104,45 @@ private:
 	taMutex* mMutex = nullptr;
 };
 
-using MutexLockGuard = LockGuard<Mutex>;
\ No newline at end of file
+using MutexLockGuard = LockGuard<Mutex>;
+
+
+// Equivalent of LockGuard for the shared side of a SharedMutex.
+template <typename taMutex>
+struct SharedLockGuard : NoCopy
+{
+	SharedLockGuard() = default;
+	SharedLockGuard(taMutex& ioMutex)
+	{
+		mMutex = &ioMutex;
+		mMutex->LockShared();
+	}
+
+	~SharedLockGuard()
+	{
+		if (mMutex)
+			mMutex->UnlockShared();
+	}
+
+	SharedLockGuard(SharedLockGuard&& ioOther)
+	{
+		mMutex         = ioOther.mMutex;
+		ioOther.mMutex = nullptr;
+	}
+	SharedLockGuard& operator=(SharedLockGuard&& ioOther)
+	{
+		mMutex         = ioOther.mMutex;
+		ioOther.mMutex = nullptr;
+		return *this;
+	}
+
+	void UnlockShared()
+	{
+		mMutex->UnlockShared();
+	}
+
+	const taMutex* GetMutex() const { return mMutex; }
+
+private:
+	taMutex* mMutex = nullptr;
+};
\ No newline at end of file
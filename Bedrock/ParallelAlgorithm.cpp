@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/ParallelAlgorithm.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Random.h>
+
+
+REGISTER_TEST("ParallelFor")
+{
+	TaskScheduler scheduler;
+	scheduler.Init({ .mNumWorkers = 3 });
+
+	// Each index should be visited exactly once.
+	constexpr int cSize = 100000;
+	Vector<int>	  visited;
+	visited.Resize(cSize);
+
+	gParallelFor(0, cSize, 1024, [&visited](int inIndex) { visited[inIndex]++; });
+
+	for (int count : visited)
+		TEST_TRUE(count == 1);
+
+	// Empty and single-chunk ranges.
+	AtomicInt32 sum = 0;
+	gParallelFor(0, 0, 16, [&sum](int) { sum.Add(1); });
+	TEST_TRUE(sum.Load() == 0);
+
+	gParallelFor(0, 10, 1024, [&sum](int) { sum.Add(1); });
+	TEST_TRUE(sum.Load() == 10);
+
+	scheduler.Shutdown();
+
+	// Without a scheduler it should fall back to a serial loop.
+	gParallelFor(0, 10, 2, [&sum](int) { sum.Add(1); });
+	TEST_TRUE(sum.Load() == 20);
+};
+
+
+REGISTER_TEST("ParallelSort")
+{
+	TaskScheduler scheduler;
+	scheduler.Init({ .mNumWorkers = 3 });
+
+	// Large enough to actually fork tasks (the serial threshold is 4096).
+	constexpr int cSize = 200000;
+	Vector<int>	  values;
+	int			  rand_seed = 42;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		values.PushBack(rand_seed);
+	}
+
+	gParallelSort(values);
+
+	for (int i = 1; i < values.Size(); i++)
+		TEST_TRUE(values[i - 1] <= values[i]);
+
+	// Custom comparison.
+	gParallelSort(values, [](int inA, int inB) { return inA > inB; });
+
+	for (int i = 1; i < values.Size(); i++)
+		TEST_TRUE(values[i - 1] >= values[i]);
+
+	scheduler.Shutdown();
+};
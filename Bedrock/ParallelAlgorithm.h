@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/TaskScheduler.h>
+
+// Parallel versions of some algorithms, built on TaskScheduler.
+// They live in a separate header because Algorithm.h is included from the low level containers
+// and cannot depend on the scheduler.
+
+
+// Call inFunc(index) for every index in [inBegin, inEnd), in parallel.
+// The range is split into chunks of inGrainSize indices; pick a grain large enough that a chunk
+// is worth a task (and that neighboring chunks don't share cache lines if inFunc writes).
+// Falls back to a serial loop if there is no scheduler.
+// Must be called from a scheduler-registered thread, and blocks until every index was processed.
+template <typename taFunc>
+void gParallelFor(int inBegin, int inEnd, int inGrainSize, const taFunc& inFunc, TaskScheduler* ioScheduler = TaskScheduler::sGetDefault())
+{
+	gAssert(inGrainSize > 0);
+
+	int count = inEnd - inBegin;
+	if (count <= 0)
+		return;
+
+	// Single chunk or no scheduler: just run serially.
+	if (ioScheduler == nullptr || count <= inGrainSize)
+	{
+		for (int i = inBegin; i < inEnd; i++)
+			inFunc(i);
+		return;
+	}
+
+	TaskCounter counter;
+
+	for (int chunk_begin = inBegin; chunk_begin < inEnd; chunk_begin += inGrainSize)
+	{
+		int chunk_end = gMin(chunk_begin + inGrainSize, inEnd);
+
+		ioScheduler->Submit([&inFunc, chunk_begin, chunk_end]
+		{
+			for (int i = chunk_begin; i < chunk_end; i++)
+				inFunc(i);
+		}, &counter);
+	}
+
+	ioScheduler->Wait(counter);
+}
+
+
+namespace Details
+{
+	// Everything the parallel sort tasks need, kept alive by gParallelSort until the last task is done.
+	template <typename taCompare>
+	struct ParallelSortContext
+	{
+		TaskScheduler& mScheduler;
+		TaskCounter    mCounter;
+		taCompare      mComp;
+	};
+
+	template <typename taIterator, typename taCompare>
+	void sParallelSort(ParallelSortContext<taCompare>& ioContext, taIterator inBegin, taIterator inEnd, int inDepth)
+	{
+		// Below this size forking isn't worth it, and past this depth the partitions are
+		// small enough to keep every core busy anyway; sort serially in both cases.
+		constexpr int64 cSerialThreshold = 4096;
+		constexpr int   cMaxDepth        = 16;
+
+		while (inEnd - inBegin > cSerialThreshold && inDepth < cMaxDepth)
+		{
+			inDepth++;
+
+			taIterator pivot = sMedianPartition(inBegin, inEnd, ioContext.mComp);
+
+			// Submit the left partition as a task and keep sorting the right one here.
+			taIterator left_begin = inBegin;
+			taIterator left_end   = pivot;
+			ioContext.mScheduler.Submit([&ioContext, left_begin, left_end, inDepth]
+			{
+				sParallelSort(ioContext, left_begin, left_end, inDepth);
+			}, &ioContext.mCounter);
+
+			inBegin = pivot + 1;
+		}
+
+		gSort(inBegin, inEnd, ioContext.mComp);
+	}
+}
+
+
+// Sort a [inBegin, inEnd) range in parallel. Not stable (equal elements may be reordered).
+// Parallel quicksort: partitions are split off as tasks until they get small, then sorted with gSort.
+// Falls back to a plain gSort if there is no scheduler.
+// Must be called from a scheduler-registered thread, and blocks until the range is sorted.
+template <typename taIterator, typename taCompare = Details::SortLess>
+void gParallelSort(taIterator inBegin, taIterator inEnd, taCompare ioComp = {}, TaskScheduler* ioScheduler = TaskScheduler::sGetDefault())
+{
+	if (ioScheduler == nullptr)
+	{
+		gSort(inBegin, inEnd, gMove(ioComp));
+		return;
+	}
+
+	Details::ParallelSortContext<taCompare> context = { *ioScheduler, {}, gMove(ioComp) };
+
+	Details::sParallelSort(context, inBegin, inEnd, 0);
+
+	ioScheduler->Wait(context.mCounter);
+}
+
+
+// Sort a vector-like container in parallel. Not stable (equal elements may be reordered).
+template <typename taContainer, typename taCompare = Details::SortLess>
+void gParallelSort(taContainer& ioContainer, taCompare ioComp = {}, TaskScheduler* ioScheduler = TaskScheduler::sGetDefault()) requires requires { ioContainer.Begin(); }
+{
+	gParallelSort(ioContainer.Begin(), ioContainer.End(), gMove(ioComp), ioScheduler);
+}
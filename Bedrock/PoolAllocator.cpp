@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/PoolAllocator.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("PoolAllocator")
+{
+	struct Node
+	{
+		int  mValue;
+		char mPadding[60]; // Typical small-node size.
+	};
+
+	PoolAllocator<Node> pool(4); // Small chunks to exercise chunk growth.
+
+	// Allocate more than one chunk's worth; all slots must be distinct and writable.
+	Node* nodes[10] = {};
+	for (int i = 0; i < 10; i++)
+	{
+		nodes[i] = pool.Allocate(1);
+		TEST_TRUE(nodes[i] != nullptr);
+		nodes[i]->mValue = i;
+	}
+	TEST_TRUE(pool.GetNumAllocated() == 10);
+
+	for (int i = 0; i < 10; i++)
+	{
+		TEST_TRUE(nodes[i]->mValue == i);
+
+		for (int j = i + 1; j < 10; j++)
+			TEST_TRUE(nodes[i] != nodes[j]);
+	}
+
+	// Freed slots are recycled, most recently freed first.
+	pool.Free(nodes[3], 1);
+	pool.Free(nodes[7], 1);
+	TEST_TRUE(pool.GetNumAllocated() == 8);
+
+	Node* recycled1 = pool.Allocate(1);
+	Node* recycled2 = pool.Allocate(1);
+	TEST_TRUE(recycled1 == nodes[7]);
+	TEST_TRUE(recycled2 == nodes[3]);
+
+	for (Node* node : nodes)
+		pool.Free(node, 1);
+	TEST_TRUE(pool.GetNumAllocated() == 0);
+
+	// Multi-object allocations fall back to the heap.
+	Node* array = pool.Allocate(5);
+	TEST_TRUE(array != nullptr);
+	TEST_TRUE(pool.GetNumAllocated() == 0);
+	pool.Free(array, 5);
+
+	// Moving the pool keeps the slabs alive.
+	Node* moved_node = pool.Allocate(1);
+	pool.Free(moved_node, 1);
+	PoolAllocator<Node> moved_pool = gMove(pool);
+	TEST_TRUE(moved_pool.Allocate(1) == moved_node);
+	moved_pool.Free(moved_node, 1);
+};
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Memory.h>
+#include <Bedrock/Vector.h>
+
+
+// Pool allocator for same-size object churn. Memory comes from chunked slabs and freed objects are
+// recycled through an intrusive free list (the link is stored inside the free slot, no per-object
+// header), so single-object Allocate/Free are O(1) and never touch the general heap once a chunk
+// exists. Allocations of more than one object fall back to the DefaultAllocator.
+// Follows the same allocator interface as the others in Allocator.h, and is single-threaded like
+// them (wrap it in a lock, or give each thread its own pool, for multi-threaded use).
+template <typename taType>
+struct PoolAllocator : NoCopy
+{
+	static constexpr int cDefaultObjectsPerChunk = 256;
+
+	PoolAllocator() = default;
+	explicit PoolAllocator(int inObjectsPerChunk) : mObjectsPerChunk(inObjectsPerChunk) { gAssert(inObjectsPerChunk > 0); }
+
+	~PoolAllocator()
+	{
+		gAssert(mNumAllocated == 0); // Everything should be freed.
+
+		for (MemBlock chunk : mChunks)
+			gMemFree(chunk);
+	}
+
+	// Move
+	PoolAllocator(PoolAllocator&& ioOther) { operator=((PoolAllocator&&)ioOther); }
+	PoolAllocator& operator=(PoolAllocator&& ioOther)
+	{
+		gAssert(mNumAllocated == 0);
+
+		for (MemBlock chunk : mChunks)
+			gMemFree(chunk);
+
+		mFreeList        = ioOther.mFreeList;
+		mNumAllocated    = ioOther.mNumAllocated;
+		mObjectsPerChunk = ioOther.mObjectsPerChunk;
+		mChunks          = gMove(ioOther.mChunks);
+
+		ioOther.mFreeList     = nullptr;
+		ioOther.mNumAllocated = 0;
+
+		return *this;
+	}
+
+	// Allocate memory.
+	taType* Allocate(int inSize)
+	{
+		// Only single objects go through the pool.
+		if (inSize != 1) [[unlikely]]
+			return DefaultAllocator<taType>::Allocate(inSize);
+
+		if (mFreeList == nullptr) [[unlikely]]
+			AllocateChunk();
+
+		FreeSlot* slot = mFreeList;
+		mFreeList      = slot->mNext;
+		mNumAllocated++;
+
+		return (taType*)slot;
+	}
+
+	void Free(taType* inPtr, int inSize)
+	{
+		if (inSize != 1) [[unlikely]]
+		{
+			DefaultAllocator<taType>::Free(inPtr, inSize);
+			return;
+		}
+
+		gAssert(inPtr != nullptr);
+		gAssert(mNumAllocated > 0);
+
+		// Store the free list link inside the freed slot.
+		FreeSlot* slot = (FreeSlot*)inPtr;
+		slot->mNext    = mFreeList;
+		mFreeList      = slot;
+		mNumAllocated--;
+	}
+
+	// Try changing the size of an existing allocation, return false if unsuccessful.
+	bool TryRealloc(taType* inPtr, int inCurrentSize, int inNewSize)
+	{
+		gAssert(inPtr != nullptr); // Call Allocate instead.
+		return false;
+	}
+
+	// Return the number of objects currently allocated.
+	int GetNumAllocated() const { return mNumAllocated; }
+
+private:
+	struct FreeSlot
+	{
+		FreeSlot* mNext;
+	};
+
+	// A slot needs to be able to hold the free list link when the object isn't alive.
+	static constexpr int64 cSlotSize = gMax((int64)sizeof(taType), (int64)sizeof(FreeSlot));
+
+	// Slabs come from gMemAlloc which guarantees 16-byte alignment.
+	static_assert(alignof(taType) <= 16);
+
+	no_inline void AllocateChunk()
+	{
+		MemBlock chunk = gMemAlloc(cSlotSize * mObjectsPerChunk);
+		mChunks.PushBack(chunk);
+
+		// Link all the slots of the new chunk into the free list, first slot in front.
+		for (int i = mObjectsPerChunk - 1; i >= 0; i--)
+		{
+			FreeSlot* slot = (FreeSlot*)(chunk.mPtr + i * cSlotSize);
+			slot->mNext    = mFreeList;
+			mFreeList      = slot;
+		}
+	}
+
+	FreeSlot*		 mFreeList        = nullptr;
+	int				 mNumAllocated    = 0;
+	int				 mObjectsPerChunk = cDefaultObjectsPerChunk;
+	Vector<MemBlock> mChunks;
+};
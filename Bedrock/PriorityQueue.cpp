@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/PriorityQueue.h>
+#include <Bedrock/Random.h>
+#include <Bedrock/String.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("PriorityQueue")
+{
+	PriorityQueue<int> queue;
+	TEST_TRUE(queue.Empty());
+
+	int rand_seed = 42;
+	for (int i = 0; i < 1000; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		queue.Push(rand_seed % 100);
+	}
+	TEST_TRUE(queue.Size() == 1000);
+
+	// Default comparison pops the highest value first.
+	int previous = queue.Top();
+	while (!queue.Empty())
+	{
+		int value = queue.Pop();
+		TEST_TRUE(value <= previous);
+		previous = value;
+	}
+
+	// A greater-than comparison pops the lowest value first (eg. the next timer deadline).
+	auto greater = [](int inA, int inB) { return inA > inB; };
+	PriorityQueue<int, decltype(greater)> timers;
+	timers.Push(30);
+	timers.Push(10);
+	timers.Push(20);
+	TEST_TRUE(timers.Top() == 10);
+	TEST_TRUE(timers.Pop() == 10);
+	TEST_TRUE(timers.Pop() == 20);
+	TEST_TRUE(timers.Pop() == 30);
+	TEST_TRUE(timers.Empty());
+
+	// Non-trivial elements are moved out by Pop (leak detection will tell).
+	PriorityQueue<String> strings;
+	strings.Push("pear with a long enough name to heap-allocate");
+	strings.Push("apple with a long enough name to heap-allocate");
+	strings.Emplace("orange with a long enough name to heap-allocate");
+	TEST_TRUE(strings.Pop() == "pear with a long enough name to heap-allocate");
+	TEST_TRUE(strings.Pop() == "orange with a long enough name to heap-allocate");
+	TEST_TRUE(strings.Pop() == "apple with a long enough name to heap-allocate");
+};
+
+
+REGISTER_TEST("PriorityQueue TempMemory")
+{
+	TEST_INIT_TEMP_MEMORY(1_KiB);
+
+	TempPriorityQueue<int> queue;
+	for (int i = 0; i < 20; i++)
+		queue.Push(i * 7 % 20);
+
+	int previous = queue.Top();
+	while (!queue.Empty())
+	{
+		int value = queue.Pop();
+		TEST_TRUE(value <= previous);
+		previous = value;
+	}
+};
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/Vector.h>
+
+
+// Priority queue adaptor over Vector, implemented with the 4-ary heap functions from Algorithm.h.
+// Top returns the highest element according to taCompare: with the default less-than comparison the
+// highest value comes out first; pass a greater-than comparison for the lowest first (eg. timers).
+template <typename taType, typename taCompare = Details::SortLess, typename taAllocator = DefaultAllocator<taType>>
+struct PriorityQueue : private taCompare
+{
+	using ValueType = taType;
+
+	// Default
+	PriorityQueue() = default;
+	~PriorityQueue() = default;
+
+	// Default with Compare (for comparisons that have state).
+	explicit PriorityQueue(taCompare&& ioCompare) : taCompare(gMove(ioCompare)) {}
+
+	// Move
+	PriorityQueue(PriorityQueue&&) = default;
+	PriorityQueue& operator=(PriorityQueue&&) = default;
+
+	// Copy
+	PriorityQueue(const PriorityQueue&) = default;
+	PriorityQueue& operator=(const PriorityQueue&) = default;
+
+	int Size() const { return mElements.Size(); }
+	bool Empty() const { return mElements.Empty(); }
+
+	void Clear() { mElements.Clear(); }
+	void Reserve(int inCapacity) { mElements.Reserve(inCapacity); }
+
+	// Return the highest element.
+	const taType& Top() const { return mElements.Front(); }
+
+	void Push(const taType& inValue) { Emplace(inValue); }
+	void Push(taType&& inValue) { Emplace(gMove(inValue)); }
+
+	template <typename... taArgs>
+	void Emplace(taArgs&&... ioArgs)
+	{
+		mElements.EmplaceBack(gForward<taArgs>(ioArgs)...);
+		gPushHeap(mElements.Begin(), mElements.End(), GetCompare());
+	}
+
+	// Remove and return the highest element.
+	taType Pop()
+	{
+		gAssert(!Empty());
+
+		gPopHeap(mElements.Begin(), mElements.End(), GetCompare());
+
+		taType top = gMove(mElements.Back());
+		mElements.PopBack();
+		return top;
+	}
+
+private:
+	taCompare& GetCompare() { return *this; }
+
+	Vector<taType, taAllocator> mElements;
+};
+
+
+// Alias for a PriorityQueue using the TempAllocator.
+template <typename taType, typename taCompare = Details::SortLess>
+using TempPriorityQueue = PriorityQueue<taType, taCompare, TempAllocator<taType>>;
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/Profiler.h>
+#include <Bedrock/Mutex.h>
+#include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
+#include <Bedrock/Vector.h>
+
+#include <stdio.h>
+
+#define VC_EXTRALEAN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+
+namespace Details
+{
+	bool gProfilerRecording = false;
+}
+
+namespace
+{
+
+struct ProfileEvent
+{
+	const char* mName;
+	int64       mBeginTicks;
+	int64       mEndTicks;
+};
+
+
+// Per-thread event buffer, registered in a global list for export. VMem-backed so that growing
+// only commits more pages: no locks and no heap allocation on the recording path.
+struct ProfileEventBuffer : NoCopy
+{
+	ProfileEventBuffer();
+	~ProfileEventBuffer();
+
+	uint32                   mThreadID;
+	VMemVector<ProfileEvent> mEvents;
+};
+
+
+struct Profiler
+{
+	// Events that outlived their thread, kept until gProfilerClear.
+	struct RetiredBuffer
+	{
+		uint32                   mThreadID;
+		VMemVector<ProfileEvent> mEvents;
+	};
+
+	// Reserve upfront so that registering a buffer usually doesn't allocate; thread_local
+	// registration can happen anywhere, including inside tests where allocations are leak-checked.
+	Profiler() { mBuffers.Reserve(64); }
+
+	Mutex                       mMutex; // Protects both lists.
+	Vector<ProfileEventBuffer*> mBuffers;
+	Vector<RetiredBuffer>       mRetiredBuffers;
+};
+
+Profiler sProfiler;
+thread_local ProfileEventBuffer sProfileEventBuffer;
+
+
+ProfileEventBuffer::ProfileEventBuffer()
+	: mThreadID(GetCurrentThreadId())
+{
+	LockGuard lock(sProfiler.mMutex);
+	sProfiler.mBuffers.PushBack(this);
+}
+
+
+ProfileEventBuffer::~ProfileEventBuffer()
+{
+	LockGuard lock(sProfiler.mMutex);
+
+	// Keep the events around for export.
+	if (!mEvents.Empty())
+		sProfiler.mRetiredBuffers.PushBack({ mThreadID, gMove(mEvents) });
+
+	for (int i = 0; i < sProfiler.mBuffers.Size(); i++)
+	{
+		if (sProfiler.mBuffers[i] == this)
+		{
+			sProfiler.mBuffers.SwapErase(i);
+			break;
+		}
+	}
+}
+
+} // namespace
+
+
+void Details::ProfilerRecord(const char* inName, int64 inBeginTicks, int64 inEndTicks)
+{
+	sProfileEventBuffer.mEvents.PushBack({ inName, inBeginTicks, inEndTicks });
+}
+
+
+void gProfilerStart()
+{
+	Details::gProfilerRecording = true;
+}
+
+
+void gProfilerStop()
+{
+	Details::gProfilerRecording = false;
+}
+
+
+void gProfilerClear()
+{
+	gAssert(!Details::gProfilerRecording);
+
+	LockGuard lock(sProfiler.mMutex);
+
+	for (ProfileEventBuffer* buffer : sProfiler.mBuffers)
+		buffer->mEvents.Clear();
+
+	sProfiler.mRetiredBuffers.Clear();
+}
+
+
+String gProfilerExportChromeTrace()
+{
+	String json;
+	json.Append("{\"traceEvents\":[\n");
+
+	bool first = true;
+	auto append_events = [&json, &first](uint32 inThreadID, Span<const ProfileEvent> inEvents)
+	{
+		for (const ProfileEvent& event : inEvents)
+		{
+			// Timestamps and durations are in microseconds, relative to process start.
+			double ts  = gTicksToNanoseconds(event.mBeginTicks - gProcessStartTicks) / 1000.0;
+			double dur = gTicksToNanoseconds(event.mEndTicks - event.mBeginTicks) / 1000.0;
+
+			gAppendFormat(json, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+				first ? "" : ",\n", event.mName, inThreadID, ts, dur);
+			first = false;
+		}
+	};
+
+	LockGuard lock(sProfiler.mMutex);
+
+	for (const ProfileEventBuffer* buffer : sProfiler.mBuffers)
+		append_events(buffer->mThreadID, buffer->mEvents);
+
+	for (const Profiler::RetiredBuffer& buffer : sProfiler.mRetiredBuffers)
+		append_events(buffer.mThreadID, buffer.mEvents);
+
+	json.Append("\n]}\n");
+	return json;
+}
+
+
+bool gProfilerSaveChromeTrace(const char* inPath)
+{
+	String json = gProfilerExportChromeTrace();
+
+	PUSH_DISABLE_DEPRECATED_WARNING;
+	FILE* file = fopen(inPath, "wb");
+	POP_WARNING;
+
+	if (file == nullptr)
+		return false;
+
+	bool success = fwrite(json.Data(), 1, json.Size(), file) == (size_t)json.Size();
+	success      = (fclose(file) == 0) && success;
+	return success;
+}
+
+
+REGISTER_TEST("Profiler")
+{
+	gProfilerClear();
+	gProfilerStart();
+
+	{
+		PROFILE_SCOPE("ProfilerTestOuter");
+		PROFILE_SCOPE("ProfilerTestInner");
+	}
+
+	// Scopes on other threads go to their own buffer, and survive the thread exiting.
+	Thread thread;
+	thread.Create({}, [](Thread&)
+	{
+		PROFILE_SCOPE("ProfilerTestThread");
+	});
+	thread.Join();
+
+	gProfilerStop();
+
+	{
+		PROFILE_SCOPE("ProfilerTestNotRecorded"); // Not recorded, profiler is stopped.
+	}
+
+	String json = gProfilerExportChromeTrace();
+	TEST_TRUE(json.Contains("ProfilerTestOuter"));
+	TEST_TRUE(json.Contains("ProfilerTestInner"));
+	TEST_TRUE(json.Contains("ProfilerTestThread"));
+	TEST_FALSE(json.Contains("ProfilerTestNotRecorded"));
+	TEST_TRUE(json.Contains("\"ph\":\"X\""));
+
+	gProfilerClear();
+	TEST_FALSE(gProfilerExportChromeTrace().Contains("ProfilerTestOuter"));
+};
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Ticks.h>
+#include <Bedrock/String.h>
+
+// Record a profile event covering the enclosing scope.
+// eg. PROFILE_SCOPE("UpdatePhysics");
+// The name must be a string literal (or otherwise outlive the profiler), only the pointer is stored.
+// Cheap enough to stay in hot paths: when the profiler isn't started this is two flag checks, and
+// when it is, the begin/end ticks go into a per-thread buffer (no locks, no heap allocation).
+#define PROFILE_SCOPE(name) ProfileScope TOKEN_PASTE(profile_scope_, __LINE__)(name)
+
+
+namespace Details
+{
+	// True while the profiler is recording. Only written by gProfilerStart/gProfilerStop.
+	extern bool gProfilerRecording;
+
+	// Append one event to the calling thread's buffer.
+	void ProfilerRecord(const char* inName, int64 inBeginTicks, int64 inEndTicks);
+}
+
+
+// Start recording profile events.
+void gProfilerStart();
+
+// Stop recording. Events are kept until gProfilerClear is called.
+void gProfilerStop();
+
+// Discard all recorded events, including those of exited threads.
+// Only call while the profiler is stopped and no PROFILE_SCOPE is in flight.
+void gProfilerClear();
+
+// Build a capture of everything recorded so far in the Chrome trace event format.
+// Load it in chrome://tracing or https://ui.perfetto.dev.
+String gProfilerExportChromeTrace();
+
+// Write gProfilerExportChromeTrace to a file. Returns false if writing failed.
+bool gProfilerSaveChromeTrace(const char* inPath);
+
+
+// RAII helper used by PROFILE_SCOPE.
+struct ProfileScope : NoCopy
+{
+	ProfileScope(const char* inName)
+	{
+		if (Details::gProfilerRecording)
+		{
+			mName       = inName;
+			mBeginTicks = gGetTickCount();
+		}
+	}
+
+	~ProfileScope()
+	{
+		// Scopes that opened before the profiler started are not recorded.
+		if (mName != nullptr && Details::gProfilerRecording)
+			Details::ProfilerRecord(mName, mBeginTicks, gGetTickCount());
+	}
+
+private:
+	const char* mName       = nullptr;
+	int64       mBeginTicks = 0;
+};
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <Bedrock/Core.h>
+#include <Bedrock/Span.h>
 #include <Bedrock/Ticks.h>
 
 // Simple random function.
@@ -14,4 +15,89 @@ inline uint32 gRand32(uint32 inSeed = 0)
 	constexpr uint32 cMul = 48271;
 	constexpr uint32 cMod = 2147483647;
 	return inSeed * cMul % cMod;
-}
\ No newline at end of file
+}
+
+
+// Pseudo-random number generator (xoshiro256++).
+// Fast (a handful of cycles per number, no division) and statistically much stronger than gRand32,
+// at the price of 32 bytes of state. Not cryptographically secure. Use gThreadRandom for a
+// ready-to-use per-thread instance, or a locally seeded instance when reproducibility matters.
+struct Random
+{
+	// Seed from the clock.
+	Random() { Seed(((uint64)gGetTickCount() << 32) ^ (uint64)this); }
+
+	// Seed deterministically. The same seed always produces the same sequence.
+	explicit Random(uint64 inSeed) { Seed(inSeed); }
+
+	void Seed(uint64 inSeed)
+	{
+		// Expand the seed into the state with splitmix64, as the xoshiro authors recommend.
+		// This also makes sure the state can't be all zeroes (splitmix64 is a bijection).
+		for (uint64& state : mState)
+		{
+			inSeed  += 0x9E3779B97F4A7C15;
+			uint64 z = inSeed;
+			z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+			z        = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+			state    = z ^ (z >> 31);
+		}
+	}
+
+	uint64 NextUInt64()
+	{
+		uint64 result = sRotl(mState[0] + mState[3], 23) + mState[0];
+		uint64 t      = mState[1] << 17;
+
+		mState[2] ^= mState[0];
+		mState[3] ^= mState[1];
+		mState[1] ^= mState[2];
+		mState[0] ^= mState[3];
+		mState[2] ^= t;
+		mState[3]  = sRotl(mState[3], 45);
+
+		return result;
+	}
+
+	uint32 NextUInt32() { return (uint32)(NextUInt64() >> 32); } // The high bits are the strongest.
+
+	// Return a float in [0, 1).
+	float NextFloat() { return (float)(NextUInt64() >> 40) * 0x1.0p-24f; } // 24 bits, so every value is exactly representable.
+
+	// Return an int in [inMin, inMax].
+	int NextInt(int inMin, int inMax)
+	{
+		gAssert(inMin <= inMax);
+		// Lemire's multiply-shift instead of modulo; biased by at most 2^-32, fine for non-statistical uses.
+		uint64 range = (uint64)((int64)inMax - inMin) + 1;
+		return inMin + (int)((NextUInt32() * range) >> 32);
+	}
+
+	// Fill a span with random values. Faster than calling NextUInt32 in a loop for bulk uses:
+	// each step writes two values and the state stays in registers for the whole span.
+	void Fill(Span<uint32> outValues)
+	{
+		uint32* values = outValues.Begin();
+		uint32* end    = outValues.End();
+
+		while (values + 2 <= end)
+		{
+			uint64 value = NextUInt64();
+			values[0]    = (uint32)value;
+			values[1]    = (uint32)(value >> 32);
+			values      += 2;
+		}
+
+		if (values != end)
+			*values = NextUInt32();
+	}
+
+private:
+	static uint64 sRotl(uint64 inValue, int inShift) { return (inValue << inShift) | (inValue >> (64 - inShift)); }
+
+	uint64 mState[4] = {};
+};
+
+
+// Per-thread generator for when you just want random numbers and don't care about reproducibility.
+inline thread_local Random gThreadRandom;
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/RingBuffer.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
+#include <Bedrock/String.h>
+
+
+REGISTER_TEST("RingBuffer")
+{
+	RingBuffer<int, 8> buffer;
+
+	// Empty buffer.
+	int value;
+	TEST_FALSE(buffer.TryPop(value));
+
+	// FIFO order.
+	TEST_TRUE(buffer.TryPush(1));
+	TEST_TRUE(buffer.TryPush(2));
+	TEST_TRUE(buffer.TryPop(value));
+	TEST_TRUE(value == 1);
+	TEST_TRUE(buffer.TryPop(value));
+	TEST_TRUE(value == 2);
+	TEST_FALSE(buffer.TryPop(value));
+
+	// Fill it up.
+	for (int i = 0; i < 8; i++)
+		TEST_TRUE(buffer.TryPush(i));
+	TEST_FALSE(buffer.TryPush(8)); // Full.
+
+	for (int i = 0; i < 8; i++)
+	{
+		TEST_TRUE(buffer.TryPop(value));
+		TEST_TRUE(value == i);
+	}
+
+	// Span operations, repeated so they wrap around the internal storage.
+	for (int iter = 0; iter < 10; iter++)
+	{
+		int in_values[5] = { 10, 11, 12, 13, 14 };
+		TEST_TRUE(buffer.PushSpan(Span(in_values)) == 5);
+
+		int out_values[5] = {};
+		TEST_TRUE(buffer.PopSpan(Span(out_values)) == 5);
+		for (int i = 0; i < 5; i++)
+			TEST_TRUE(out_values[i] == in_values[i]);
+	}
+
+	// Partial span push/pop when there isn't enough room/data.
+	int six_values[6] = { 0, 1, 2, 3, 4, 5 };
+	TEST_TRUE(buffer.PushSpan(Span(six_values)) == 6);
+	TEST_TRUE(buffer.PushSpan(Span(six_values)) == 2); // Only 2 slots left.
+
+	int out_values[10] = {};
+	TEST_TRUE(buffer.PopSpan(Span(out_values)) == 8); // Only 8 queued.
+	TEST_TRUE(out_values[6] == 0);
+	TEST_TRUE(out_values[7] == 1);
+};
+
+
+REGISTER_TEST("RingBuffer Non-Trivial")
+{
+	// Non-trivial elements go through the move/destruct path instead of memcpy.
+	RingBuffer<String, 4> buffer;
+
+	String in_values[3] = { "a rather long string that heap-allocates", "another rather long one", "and a third one" };
+	TEST_TRUE(buffer.PushSpan(Span<const String>(in_values, 3)) == 3);
+
+	String popped;
+	TEST_TRUE(buffer.TryPop(popped));
+	TEST_TRUE(popped == in_values[0]);
+
+	String out_values[2];
+	TEST_TRUE(buffer.PopSpan(Span(out_values)) == 2);
+	TEST_TRUE(out_values[0] == in_values[1]);
+	TEST_TRUE(out_values[1] == in_values[2]);
+
+	// Elements left in the buffer are destructed with it (checked by the leak tracking).
+	TEST_TRUE(buffer.TryPush(String("left in the buffer on purpose, long enough to allocate")));
+};
+
+
+REGISTER_TEST("RingBuffer Threaded")
+{
+	constexpr int cNumValues = 100000;
+
+	RingBuffer<int, 64> buffer;
+
+	Thread producer;
+	producer.Create({ .mName = "Producer", .mTempMemSize = 0 }, [&buffer](Thread&)
+	{
+		int next = 0;
+		while (next < cNumValues)
+		{
+			// Push in batches to exercise PushSpan concurrently with the consumer.
+			int batch[16];
+			int batch_size = gMin(16, cNumValues - next);
+			for (int i = 0; i < batch_size; i++)
+				batch[i] = next + i;
+
+			int pushed = buffer.PushSpan(Span<const int>(batch, batch_size));
+			next += pushed;
+
+			if (pushed == 0)
+				gYieldThread();
+		}
+	});
+
+	// Consume on this thread, checking that values arrive in order.
+	int expected = 0;
+	while (expected < cNumValues)
+	{
+		int values[16];
+		int popped = buffer.PopSpan(Span(values));
+
+		for (int i = 0; i < popped; i++)
+		{
+			TEST_TRUE(values[i] == expected);
+			expected++;
+		}
+
+		if (popped == 0)
+			gYieldThread();
+	}
+
+	producer.Join();
+
+	int leftover;
+	TEST_FALSE(buffer.TryPop(leftover));
+};
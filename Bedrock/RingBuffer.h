@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Move.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/TypeTraits.h>
+
+
+// Bounded single-producer/single-consumer ring buffer.
+// One thread may push, one (other) thread may pop; nothing is interlocked on the fast path.
+// The write and read cursors live on separate cache lines, and each side keeps a cached copy
+// of the other side's cursor so it only touches the shared line when the buffer looks full/empty.
+template <typename taType, int taCapacity>
+struct RingBuffer : NoCopy
+{
+	static_assert(gIsPow2(taCapacity));
+
+	RingBuffer() = default;
+
+	~RingBuffer()
+	{
+		// Destruct whatever is still queued. No concurrent access is allowed at this point.
+		int64 read  = mReadPos.Load(MemoryOrder::Relaxed);
+		int64 write = mWritePos.Load(MemoryOrder::Relaxed);
+		for (; read < write; read++)
+			Element(read).~taType();
+	}
+
+	static constexpr int Capacity() { return taCapacity; }
+
+	// Return true if the buffer looks empty. Safe to call from either thread,
+	// but the result may already be stale by the time it returns.
+	bool Empty() const { return mReadPos.Load() == mWritePos.Load(); }
+
+	// Add an element to the buffer. Producer thread only. Returns false if the buffer is full.
+	template <typename taValue>
+	bool TryPush(taValue&& ioValue)
+	{
+		int64 write = mWritePos.Load(MemoryOrder::Relaxed);
+
+		if (write - mCachedReadPos == taCapacity)
+		{
+			// Looks full, check the consumer's actual position.
+			mCachedReadPos = mReadPos.Load(MemoryOrder::Acquire);
+			if (write - mCachedReadPos == taCapacity)
+				return false;
+		}
+
+		gPlacementNew(Element(write), gForward<taValue>(ioValue));
+		mWritePos.Store(write + 1, MemoryOrder::Release);
+		return true;
+	}
+
+	// Remove the oldest element from the buffer. Consumer thread only. Returns false if the buffer is empty.
+	bool TryPop(taType& outValue)
+	{
+		int64 read = mReadPos.Load(MemoryOrder::Relaxed);
+
+		if (read == mCachedWritePos)
+		{
+			// Looks empty, check the producer's actual position.
+			mCachedWritePos = mWritePos.Load(MemoryOrder::Acquire);
+			if (read == mCachedWritePos)
+				return false;
+		}
+
+		taType& element = Element(read);
+		outValue        = gMove(element);
+		element.~taType();
+		mReadPos.Store(read + 1, MemoryOrder::Release);
+		return true;
+	}
+
+	// Add as many elements from inValues as fit in the buffer. Producer thread only.
+	// Returns how many were added. Trivially copyable types are transferred with at most two memcpys.
+	int PushSpan(Span<const taType> inValues)
+	{
+		int64 write = mWritePos.Load(MemoryOrder::Relaxed);
+
+		if (taCapacity - (write - mCachedReadPos) < inValues.Size())
+			mCachedReadPos = mReadPos.Load(MemoryOrder::Acquire);
+
+		int count = (int)gMin((int64)inValues.Size(), taCapacity - (write - mCachedReadPos));
+
+		if constexpr (cIsTriviallyCopyable<taType>)
+		{
+			// The free space is contiguous except for the wrap, so two copies at most.
+			int first_chunk = gMin(count, taCapacity - (int)(write & (taCapacity - 1)));
+			gMemCopy(&Element(write), inValues.Data(), first_chunk * (int)sizeof(taType));
+			gMemCopy(&Element(write + first_chunk), inValues.Data() + first_chunk, (count - first_chunk) * (int)sizeof(taType));
+		}
+		else
+		{
+			for (int i = 0; i < count; i++)
+				gPlacementNew(Element(write + i), inValues[i]);
+		}
+
+		mWritePos.Store(write + count, MemoryOrder::Release);
+		return count;
+	}
+
+	// Remove up to outValues.Size() of the oldest elements into outValues. Consumer thread only.
+	// Returns how many were removed. Trivially copyable types are transferred with at most two memcpys.
+	int PopSpan(Span<taType> outValues)
+	{
+		int64 read = mReadPos.Load(MemoryOrder::Relaxed);
+
+		if (mCachedWritePos - read < outValues.Size())
+			mCachedWritePos = mWritePos.Load(MemoryOrder::Acquire);
+
+		int count = (int)gMin((int64)outValues.Size(), mCachedWritePos - read);
+
+		if constexpr (cIsTriviallyCopyable<taType>)
+		{
+			int first_chunk = gMin(count, taCapacity - (int)(read & (taCapacity - 1)));
+			gMemCopy(outValues.Data(), &Element(read), first_chunk * (int)sizeof(taType));
+			gMemCopy(outValues.Data() + first_chunk, &Element(read + first_chunk), (count - first_chunk) * (int)sizeof(taType));
+		}
+		else
+		{
+			for (int i = 0; i < count; i++)
+			{
+				taType& element = Element(read + i);
+				outValues[i]    = gMove(element);
+				element.~taType();
+			}
+		}
+
+		mReadPos.Store(read + count, MemoryOrder::Release);
+		return count;
+	}
+
+private:
+	taType& Element(int64 inPos) { return ((taType*)mStorage)[inPos & (taCapacity - 1)]; }
+
+	alignas(64) Atomic<int64> mWritePos      = 0; // Written by the producer only.
+	int64                     mCachedReadPos = 0; // Producer's cached copy of mReadPos, shares its cache line with mWritePos.
+
+	alignas(64) Atomic<int64> mReadPos        = 0; // Written by the consumer only.
+	int64                     mCachedWritePos = 0; // Consumer's cached copy of mWritePos, shares its cache line with mReadPos.
+
+	alignas(64) alignas(taType) uint8 mStorage[taCapacity * sizeof(taType)];
+};
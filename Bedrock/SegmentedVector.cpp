@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/SegmentedVector.h>
+#include <Bedrock/PoolAllocator.h>
+#include <Bedrock/String.h>
+#include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("SegmentedVector")
+{
+	SegmentedVector<int, 4> test;
+	TEST_TRUE(test.Empty());
+
+	// Grow over several segments; addresses have to stay stable.
+	int* first_element = &test.EmplaceBack(0);
+	for (int i = 1; i < 20; i++)
+		test.PushBack(i);
+
+	TEST_TRUE(test.Size() == 20);
+	TEST_TRUE(test.Capacity() == 20); // 5 segments of 4.
+	TEST_TRUE(&test[0] == first_element);
+
+	for (int i = 0; i < 20; i++)
+		TEST_TRUE(test[i] == i);
+
+	// Iteration sees the elements in order.
+	int expected = 0;
+	for (int value : test)
+		TEST_TRUE(value == expected++);
+	TEST_TRUE(expected == 20);
+
+	test.PopBack();
+	TEST_TRUE(test.Size() == 19);
+	TEST_TRUE(test.Capacity() == 20); // Segments are kept.
+
+	// Copy and move.
+	SegmentedVector<int, 4> copy = test;
+	TEST_TRUE(copy.Size() == 19);
+	TEST_TRUE(copy[7] == 7);
+
+	SegmentedVector<int, 4> moved = gMove(copy);
+	TEST_TRUE(copy.Empty());
+	TEST_TRUE(moved.Size() == 19);
+
+	test.Clear();
+	TEST_TRUE(test.Empty());
+	TEST_TRUE(test.Capacity() == 20);
+	test.ClearAndFreeMemory();
+	TEST_TRUE(test.Capacity() == 0);
+
+	// Non-trivial elements are destructed properly (leak detection will tell).
+	SegmentedVector<String, 8> strings;
+	for (int i = 0; i < 20; i++)
+		strings.EmplaceBack(gFormat("a rather long string that heap-allocates %d", i));
+	TEST_TRUE(strings[15] == "a rather long string that heap-allocates 15");
+
+	// Segments are all the same size, so a PoolAllocator can back them.
+	SegmentedVector<int, 16, PoolAllocator> pooled;
+	for (int i = 0; i < 100; i++)
+		pooled.PushBack(i);
+	TEST_TRUE(pooled.Size() == 100);
+	TEST_TRUE(pooled[99] == 99);
+
+	static_assert(cIsStable<SegmentedVector<int, 4>>);
+};
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Allocator.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/TypeTraits.h>
+#include <Bedrock/Vector.h>
+
+
+// Vector-like container storing its elements in fixed-size segments instead of one contiguous allocation.
+// Growing allocates one new segment and never moves existing elements, so addresses are stable
+// (like VMemVector but without reserving address space up front, which matters when there are many
+// containers) and there are no reallocation copy spikes. Indexing is a shift and a mask.
+// The segments are all the same size, which makes a PoolAllocator an ideal backing for them
+// (eg. SegmentedVector<Entity, 64, PoolAllocator>). The elements are not contiguous, so no Data()
+// and no Span conversion; use indexing or iteration instead.
+template <typename taType, int taSegmentSize = 64, template <typename> typename taAllocator = DefaultAllocator>
+struct SegmentedVector
+{
+	static_assert(gIsPow2(taSegmentSize)); // Needed for the shift/mask indexing.
+
+	using ValueType = taType;
+
+	// Segments are raw storage, elements are constructed in place as they're added.
+	struct Segment
+	{
+		alignas(taType) uint8 mStorage[taSegmentSize * sizeof(taType)];
+
+		taType*       Elements()       { return (taType*)mStorage; }
+		const taType* Elements() const { return (const taType*)mStorage; }
+	};
+
+	using Allocator = taAllocator<Segment>;
+
+	// Default
+	SegmentedVector() = default;
+	~SegmentedVector()
+	{
+		Clear();
+
+		for (Segment* segment : mSegments)
+			mAllocator.Free(segment, 1);
+	}
+
+	// Default with Allocator
+	explicit SegmentedVector(Allocator&& ioAllocator) : mAllocator(gMove(ioAllocator)) {}
+
+	// Move
+	SegmentedVector(SegmentedVector&& ioOther) { MoveFrom(gMove(ioOther)); }
+	SegmentedVector& operator=(SegmentedVector&& ioOther) { MoveFrom(gMove(ioOther)); return *this; }
+
+	// Copy
+	SegmentedVector(const SegmentedVector& inOther) { *this = inOther; }
+	SegmentedVector& operator=(const SegmentedVector& inOther)
+	{
+		Clear();
+		Reserve(inOther.Size());
+
+		for (const taType& element : inOther)
+			PushBack(element);
+
+		return *this;
+	}
+
+	int Size() const { return mSize; }
+	int Capacity() const { return mSegments.Size() * taSegmentSize; }
+	bool Empty() const { return mSize == 0; }
+
+	taType& operator[](int inPosition)
+	{
+		gBoundsCheck(inPosition, mSize);
+		return mSegments[inPosition >> cSegmentShift]->Elements()[inPosition & cSegmentMask];
+	}
+
+	const taType& operator[](int inPosition) const
+	{
+		gBoundsCheck(inPosition, mSize);
+		return mSegments[inPosition >> cSegmentShift]->Elements()[inPosition & cSegmentMask];
+	}
+
+	taType& Front() { return operator[](0); }
+	taType& Back()  { return operator[](mSize - 1); }
+	const taType& Front() const { return operator[](0); }
+	const taType& Back()  const { return operator[](mSize - 1); }
+
+	// Allocate enough segments to store inCapacity elements.
+	void Reserve(int inCapacity)
+	{
+		while (Capacity() < inCapacity)
+			mSegments.PushBack(mAllocator.Allocate(1));
+	}
+
+	void PushBack(const taType& inValue) { EmplaceBack(inValue); }
+	void PushBack(taType&& inValue) { EmplaceBack(gMove(inValue)); }
+
+	template <typename... taArgs>
+	taType& EmplaceBack(taArgs&&... inArgs)
+	{
+		if (mSize == Capacity())
+			mSegments.PushBack(mAllocator.Allocate(1));
+
+		taType& back = mSegments[mSize >> cSegmentShift]->Elements()[mSize & cSegmentMask];
+		gPlacementNew(back, gForward<taArgs>(inArgs)...);
+		mSize++;
+
+		return back;
+	}
+
+	void PopBack()
+	{
+		gAssert(mSize >= 1);
+		mSize--;
+		mSegments[mSize >> cSegmentShift]->Elements()[mSize & cSegmentMask].~taType();
+	}
+
+	// Destroy all the elements. The segments are kept (use ClearAndFreeMemory to free them).
+	void Clear()
+	{
+		for (int i = 0, n = mSize; i < n; i++)
+			operator[](i).~taType();
+
+		mSize = 0;
+	}
+
+	void ClearAndFreeMemory()
+	{
+		Clear();
+
+		for (Segment* segment : mSegments)
+			mAllocator.Free(segment, 1);
+
+		mSegments.ClearAndFreeMemory();
+	}
+
+	// Iterator. The elements aren't contiguous so this can't be a raw pointer.
+	template <typename taVector, typename taValue>
+	struct IterBase
+	{
+		taValue& operator*() const { return (*mVector)[mIndex]; }
+		taValue* operator->() const { return &(*mVector)[mIndex]; }
+		IterBase& operator++() { mIndex++; return *this; }
+		bool operator==(const IterBase&) const = default;
+
+		taVector* mVector = nullptr;
+		int       mIndex  = 0;
+	};
+
+	using Iter      = IterBase<SegmentedVector, taType>;
+	using ConstIter = IterBase<const SegmentedVector, const taType>;
+
+	Iter Begin() { return { this, 0 }; }
+	Iter End()   { return { this, mSize }; }
+	Iter begin() { return Begin(); }
+	Iter end()   { return End(); }
+	ConstIter Begin() const { return { this, 0 }; }
+	ConstIter End()   const { return { this, mSize }; }
+	ConstIter begin() const { return Begin(); }
+	ConstIter end()   const { return End(); }
+
+private:
+	static constexpr int cSegmentShift = []() { int shift = 0; while ((1 << shift) < taSegmentSize) shift++; return shift; }();
+	static constexpr int cSegmentMask  = taSegmentSize - 1;
+
+	void MoveFrom(SegmentedVector&& ioOther)
+	{
+		ClearAndFreeMemory();
+
+		mAllocator = gMove(ioOther.mAllocator);
+		mSegments  = gMove(ioOther.mSegments);
+		mSize      = ioOther.mSize;
+
+		ioOther.mSize = 0;
+	}
+
+	Allocator        mAllocator;
+	Vector<Segment*> mSegments; // Pointers to the segments (the segments themselves never move).
+	int              mSize = 0;
+};
+
+
+// SegmentedVector elements stay at the same address when it grows.
+template<typename taType, int taSegmentSize, template <typename> typename taAllocator>
+inline constexpr bool cIsStable<SegmentedVector<taType, taSegmentSize, taAllocator>> = true;
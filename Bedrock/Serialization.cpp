@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/Serialization.h>
+
+#include <Bedrock/Random.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("BlobWriterReader")
+{
+	struct Header
+	{
+		uint32 mMagic   = 0;
+		uint32 mVersion = 0;
+	};
+
+	BlobWriter writer;
+	writer.Write(Header{ 0xB10B, 1 });
+	writer.Write((uint8)42);
+	writer.Write((uint64)0x123456789ABCDEF0); // Needs padding after the uint8.
+	writer.Write(StringView("hello blob"));
+
+	Vector<int> values = { 1, 2, 3, 4, 5 };
+	writer.Write(values);
+
+	// Copy the bytes to a different location, as if written to a file and mapped back:
+	// everything must be relocatable.
+	Vector<uint8> blob;
+	blob.Resize(writer.GetBytes().Size(), EResizeInit::NoZeroInit);
+	gMemCopy(blob.Data(), writer.GetBytes().Data(), blob.Size());
+
+	BlobReader reader(Span<const uint8>(blob));
+
+	const Header& header = reader.Read<Header>();
+	TEST_TRUE(header.mMagic == 0xB10B);
+	TEST_TRUE(header.mVersion == 1);
+	TEST_TRUE((uint64)&header % alignof(Header) == 0); // Declared alignment is respected in place.
+
+	TEST_TRUE(reader.Read<uint8>() == 42);
+	TEST_TRUE(reader.Read<uint64>() == 0x123456789ABCDEF0);
+
+	// The string and span views point inside the blob, not at copies.
+	StringView text = reader.ReadString();
+	TEST_TRUE(text == "hello blob");
+	TEST_TRUE(text.AsCStr() != nullptr); // Null-terminated in the blob.
+	TEST_TRUE((const uint8*)text.Data() >= blob.Begin() && (const uint8*)text.Data() < blob.End());
+
+	Span<const int> read_values = reader.ReadSpan<int>();
+	TEST_TRUE(read_values == Span<const int>(values));
+	TEST_TRUE((const uint8*)read_values.Data() >= blob.Begin() && (const uint8*)read_values.Data() < blob.End());
+
+	TEST_TRUE(reader.AtEnd());
+};
+
+
+REGISTER_TEST("BlobHashMap")
+{
+	// Build a map, serialize it, and query the serialized bytes in place.
+	HashMap<uint32, int> map;
+	int                  rand_seed = 42;
+	for (int i = 0; i < 1000; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		map.InsertOrAssign((uint32)rand_seed, i);
+	}
+
+	BlobWriter writer;
+	writer.Write(map);
+
+	HashSet<uint32> set;
+	for (int i = 0; i < 100; i++)
+		set.Insert((uint32)i * 3);
+	writer.Write(set);
+
+	BlobReader reader(writer.GetBytes());
+
+	HashMapView<uint32, int> map_view = reader.ReadHashMap<uint32, int>();
+	TEST_TRUE(map_view.Size() == map.Size());
+
+	// Every key resolves to the same value as in the original map, without any rehashing at load.
+	for (const auto& key_value : map)
+	{
+		auto iter = map_view.Find(key_value.mKey);
+		TEST_TRUE(iter != map_view.End());
+		TEST_TRUE(iter->mValue == key_value.mValue);
+	}
+
+	// Keys that aren't in the map aren't found.
+	rand_seed = 1;
+	for (int i = 0; i < 100; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		uint32 key = (uint32)rand_seed;
+		TEST_TRUE(map_view.Contains(key) == map.Contains(key));
+	}
+
+	HashSetView<uint32> set_view = reader.ReadHashSet<uint32>();
+	TEST_TRUE(set_view.Size() == 100);
+	TEST_TRUE(set_view.Contains(33));
+	TEST_FALSE(set_view.Contains(34));
+	TEST_TRUE(reader.AtEnd());
+
+	// An empty map serializes and reads back fine.
+	HashMap<uint32, int> empty_map;
+	BlobWriter           empty_writer;
+	empty_writer.Write(empty_map);
+
+	BlobReader               empty_reader(empty_writer.GetBytes());
+	HashMapView<uint32, int> empty_view = empty_reader.ReadHashMap<uint32, int>();
+	TEST_TRUE(empty_view.Empty());
+	TEST_TRUE(empty_view.Find(123) == empty_view.End());
+};
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/HashMap.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/String.h>
+#include <Bedrock/StringView.h>
+#include <Bedrock/TypeTraits.h>
+#include <Bedrock/Vector.h>
+
+
+// Read-only view of a HashMap serialized by BlobWriter (see BlobReader::ReadHashMap).
+// Wraps the bucket array and key-value vector exactly as the HashMap stored them, so lookups work
+// in place on the serialized bytes without any rehashing. Same probing logic as HashMap::Find.
+template <typename taKey, typename taValue, typename taHash = Hash<taKey>>
+struct HashMapView : taHash
+{
+	static constexpr bool cIsMap = !cIsVoid<taValue>;
+	static constexpr bool cIsSet = cIsVoid<taValue>;
+
+	using Bucket    = Details::HashMapBucket;
+	using KeyValue  = Conditional<cIsMap, KeyValue<taKey, taValue>, taKey>;
+	using ConstIter = const KeyValue*;
+
+	HashMapView() = default;
+	HashMapView(Span<const KeyValue> inKeyValues, Span<const Bucket> inBuckets)
+		: mKeyValues(inKeyValues), mBuckets(inBuckets) {}
+
+	int  Size() const { return mKeyValues.Size(); }
+	bool Empty() const { return mKeyValues.Empty(); }
+
+	ConstIter Begin() const { return mKeyValues.Begin(); }
+	ConstIter End() const { return mKeyValues.End(); }
+	ConstIter begin() const { return mKeyValues.Begin(); }
+	ConstIter end() const { return mKeyValues.End(); }
+
+	ConstIter Find(const taKey& inKey) const
+	{
+		return FindInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	ConstIter Find(const taAltKey& inKey) const
+	{
+		return FindInternal(inKey);
+	}
+
+	bool Contains(const taKey& inKey) const
+	{
+		return FindInternal(inKey) != End();
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Contains(const taAltKey& inKey) const
+	{
+		return FindInternal(inKey) != End();
+	}
+
+private:
+	static const taKey& GetKey(const KeyValue& inKeyValue)
+	{
+		if constexpr (cIsMap)
+			return inKeyValue.mKey;
+		else
+			return inKeyValue;
+	}
+
+	// Same walk as HashMap::FindBucketWithHash, minus the insertion bookkeeping.
+	template <typename taAltKey>
+	ConstIter FindInternal(const taAltKey& inKey) const
+	{
+		if (Empty()) [[unlikely]]
+			return End();
+
+		const uint64 hash         = taHash::operator()(inKey);
+		const int    buckets_mask = mBuckets.Size() - 1;
+		int          bucket_index = (int)hash & buckets_mask;
+		uint32       distance_and_fingerprint = Bucket::sGetDistanceAndFingerprint(hash);
+
+		while (true)
+		{
+			Bucket bucket = mBuckets[bucket_index];
+
+			if (bucket.mDistanceAndFingerprint == distance_and_fingerprint) [[likely]]
+			{
+				if (GetKey(mKeyValues[bucket.mKeyValueIndex]) == inKey) [[likely]]
+					return mKeyValues.Begin() + bucket.mKeyValueIndex;
+			}
+			else if (bucket.mDistanceAndFingerprint < distance_and_fingerprint)
+			{
+				// Distance is lower, the key can't be further away.
+				return End();
+			}
+
+			distance_and_fingerprint += Bucket::cDistanceIncrement;
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+	}
+
+	Span<const KeyValue> mKeyValues;
+	Span<const Bucket>   mBuckets;
+};
+
+
+// HashSet variant of the HashMapView.
+template <typename taKey, typename taHash = Hash<taKey>>
+using HashSetView = HashMapView<taKey, void, taHash>;
+
+
+// Serializes values and containers into a relocatable binary blob.
+// The format contains no pointers, only sizes and alignment padding, so the bytes can be written
+// to a file and later mapped (see MappedFile) and read in place with a BlobReader: Spans,
+// StringViews and HashMapViews point directly at the blob, nothing is copied or rehashed.
+// Writes and reads must happen in the same order with the same types.
+struct BlobWriter
+{
+	// Blobs must be loaded at an address aligned to this (heap and mapped file allocations both are).
+	static constexpr int cBlobAlignment = 16;
+
+	// Write a trivially-copyable value.
+	template <typename taType>
+	requires cIsTriviallyCopyable<taType>
+	void Write(const taType& inValue)
+	{
+		WriteBytes(&inValue, sizeof(taType), alignof(taType));
+	}
+
+	// Write an array of trivially-copyable elements, readable in place as a Span.
+	template <typename taType>
+	requires cIsTriviallyCopyable<taType>
+	void Write(Span<const taType> inValues)
+	{
+		Write(inValues.Size());
+		WriteBytes(inValues.Data(), inValues.Size() * (int)sizeof(taType), alignof(taType));
+	}
+
+	template <typename taType, typename taAllocator>
+	requires cIsTriviallyCopyable<taType>
+	void Write(const Vector<taType, taAllocator>& inValues)
+	{
+		Write(Span<const taType>(inValues));
+	}
+
+	// Write a string, readable in place as a StringView (null-terminated).
+	void Write(StringView inString)
+	{
+		Write(inString.Size());
+		WriteBytes(inString.Data(), inString.Size(), 1);
+		WriteBytes("", 1, 1); // Null terminator, so AsCStr works on the view.
+	}
+
+	// Write a HashMap (or HashSet), readable in place as a HashMapView that is queryable without
+	// rehashing: the key-value vector and the bucket array are stored as-is.
+	template <typename taKey, typename taValue, typename taHash, template <typename> typename taAllocator, bool taCacheHashes>
+	void Write(const HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>& inMap)
+	{
+		using KeyValue = typename HashMap<taKey, taValue, taHash, taAllocator, taCacheHashes>::KeyValue;
+		static_assert(cIsTriviallyCopyable<KeyValue>); // Keys/values with owned memory can't be read in place (intern strings instead).
+
+		Write(Span<const KeyValue>(inMap.mKeyValues));
+		Write(Span<const Details::HashMapBucket>(inMap.mBuckets));
+	}
+
+	Span<const uint8> GetBytes() const { return Span<const uint8>(mData); }
+
+private:
+	void WriteBytes(const void* inBytes, int inSize, int inAlignment)
+	{
+		gAssert(gIsPow2(inAlignment) && inAlignment <= cBlobAlignment);
+
+		// Pad with zeros up to the alignment so blobs are deterministic.
+		int offset = (int)gAlignUp(mData.Size(), inAlignment);
+		mData.Resize(offset);
+
+		mData.Resize(offset + inSize, EResizeInit::NoZeroInit);
+		gMemCopy(mData.Data() + offset, inBytes, inSize);
+	}
+
+	Vector<uint8> mData;
+};
+
+
+// Reads a blob written by BlobWriter, in place: no copies, the returned views point into the blob.
+// The blob bytes must outlive the views and be aligned to BlobWriter::cBlobAlignment.
+struct BlobReader
+{
+	explicit BlobReader(Span<const uint8> inBytes)
+		: mData(inBytes)
+	{
+		gAssert(((uint64)inBytes.Data() % BlobWriter::cBlobAlignment) == 0);
+	}
+
+	template <typename taType>
+	requires cIsTriviallyCopyable<taType>
+	const taType& Read()
+	{
+		return *(const taType*)ReadBytes(sizeof(taType), alignof(taType));
+	}
+
+	template <typename taType>
+	requires cIsTriviallyCopyable<taType>
+	Span<const taType> ReadSpan()
+	{
+		int size = Read<int>();
+		return { (const taType*)ReadBytes(size * (int)sizeof(taType), alignof(taType)), size };
+	}
+
+	StringView ReadString()
+	{
+		int size = Read<int>();
+		return { (const char*)ReadBytes(size + 1, 1), size };
+	}
+
+	template <typename taKey, typename taValue, typename taHash = Hash<taKey>>
+	HashMapView<taKey, taValue, taHash> ReadHashMap()
+	{
+		using KeyValue = typename HashMapView<taKey, taValue, taHash>::KeyValue;
+
+		Span<const KeyValue>                keyvalues = ReadSpan<KeyValue>();
+		Span<const Details::HashMapBucket>  buckets   = ReadSpan<Details::HashMapBucket>();
+		return { keyvalues, buckets };
+	}
+
+	template <typename taKey, typename taHash = Hash<taKey>>
+	HashSetView<taKey, taHash> ReadHashSet()
+	{
+		return ReadHashMap<taKey, void, taHash>();
+	}
+
+	// True once everything was read (padding aside, reads past the end assert).
+	bool AtEnd() const { return mOffset == mData.Size(); }
+
+private:
+	const void* ReadBytes(int inSize, int inAlignment)
+	{
+		mOffset = (int)gAlignUp(mOffset, inAlignment);
+		gAssert(mOffset + inSize <= mData.Size()); // Reading past the end (wrong order or types?).
+
+		const void* bytes = mData.Data() + mOffset;
+		mOffset += inSize;
+		return bytes;
+	}
+
+	Span<const uint8> mData;
+	int               mOffset = 0;
+};
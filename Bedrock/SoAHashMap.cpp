@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/SoAHashMap.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/String.h>
+#include <Bedrock/Random.h>
+
+
+REGISTER_TEST("SoAHashMap")
+{
+	SoAHashMap<String, String> map;
+	TEST_TRUE(map.Insert("bread", "butter").mResult == EInsertResult::Added);
+	TEST_TRUE(map.Insert("bread", "jam").mResult == EInsertResult::Found);
+	map["toast"] = "rubbish";
+	TEST_TRUE(map.Emplace("bun", "no").mResult == EInsertResult::Added);
+	String brioche("brioche");
+	TEST_TRUE(map.Emplace(brioche, "jam").mResult == EInsertResult::Added);
+	TEST_TRUE(map.InsertOrAssign(brioche, "peanut butter").mResult == EInsertResult::Replaced);
+	TEST_TRUE(map.InsertOrAssign("croissant", "chocolate").mResult == EInsertResult::Added);
+
+	TEST_TRUE(*map.Find("bread") == "butter");
+	TEST_TRUE(*map.Find("toast") == "rubbish");
+	TEST_TRUE(map["bun"] == "no");
+	map["bun"] = "burger";
+	TEST_TRUE(*map.Find("bun") == "burger");
+	TEST_TRUE(*map.Find("brioche") == "peanut butter");
+	TEST_TRUE(map.Find("broad") == nullptr);
+
+	// Transparent lookups work without building a String.
+	TEST_TRUE(map.Find(StringView("croissant")) != nullptr);
+	TEST_TRUE(map.Contains(StringView("toast")));
+
+	TEST_TRUE(map.Erase("toast"));
+	TEST_FALSE(map.Erase("toast"));
+	TEST_TRUE(*map.Find("bread") == "butter"); // Swap back-fill kept the other entries intact.
+	TEST_TRUE(map.Size() == 4);
+
+	// Keys and values are parallel arrays: the same index is the same entry.
+	Span<const String> keys   = map.GetKeys();
+	Span<const String> values = map.GetValues();
+	TEST_TRUE(keys.Size() == values.Size());
+	for (int i = 0; i < keys.Size(); i++)
+		TEST_TRUE(*map.Find(keys[i]) == values[i]);
+
+	// Sweeping the values doesn't need the keys at all.
+	for (String& value : map.GetValues())
+		value = "eaten";
+	TEST_TRUE(*map.Find("bread") == "eaten");
+	TEST_TRUE(*map.Find("bun") == "eaten");
+
+	// Copies are independent.
+	SoAHashMap<String, String> copy = map;
+	copy["bagel"] = "cream cheese";
+	TEST_TRUE(copy.Size() == map.Size() + 1);
+	TEST_TRUE(map.Find("bagel") == nullptr);
+
+	map.Clear();
+	TEST_TRUE(map.Empty());
+	TEST_TRUE(map.GetValues().Empty());
+};
+
+
+REGISTER_TEST("Large SoAHashMap")
+{
+	// Mirror every operation into a HashMap and check they never disagree.
+	SoAHashMap<uint32, int> map;
+	HashMap<uint32, int>    reference;
+
+	int rand_seed = 42;
+	for (int i = 0; i < 10000; i++)
+	{
+		rand_seed  = gRand32(rand_seed);
+		uint32 key = (uint32)rand_seed % 2000; // Force collisions, replacements and erases.
+
+		switch (rand_seed % 3)
+		{
+		case 0:
+			TEST_TRUE(map.InsertOrAssign(key, i).mResult == reference.InsertOrAssign(key, i).mResult);
+			break;
+		case 1:
+			TEST_TRUE(map.Insert(key, i).mResult == reference.Insert(key, i).mResult);
+			break;
+		case 2:
+			TEST_TRUE(map.Erase(key) == reference.Erase(key));
+			break;
+		}
+	}
+
+	TEST_TRUE(map.Size() == reference.Size());
+	for (const auto& key_value : reference)
+	{
+		const int* value = map.Find(key_value.mKey);
+		TEST_TRUE(value != nullptr);
+		TEST_TRUE(*value == key_value.mValue);
+	}
+};
+
+
+REGISTER_TEST("Large Temp SoAHashMap")
+{
+	TEST_INIT_TEMP_MEMORY(100_KiB);
+
+	TempSoAHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++)
+		map.Insert(i, i * 2);
+
+	for (int i = 0; i < 1000; i++)
+		TEST_TRUE(*map.Find(i) == i * 2);
+};
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/HashMap.h> // For Details::HashMapBucket and EInsertResult.
+#include <Bedrock/Span.h>
+#include <Bedrock/Vector.h>
+
+
+template <typename taKey, typename taValue>
+struct SoAInsertResult
+{
+	SoAInsertResult(const taKey& inKey, taValue& ioValue, EInsertResult inResult)
+		: mKey(inKey), mValue(ioValue), mResult(inResult)
+	{}
+
+	const taKey&  mKey;
+	taValue&      mValue;
+	EInsertResult mResult;
+};
+
+
+// HashMap variant storing keys and values in two parallel dense arrays instead of interleaved.
+// Same Robin Hood scheme as HashMap, but probing and erase back-fill only touch the keys array,
+// and sweeping all the values (GetValues) doesn't drag the keys through the cache. Worth it when
+// values are much bigger than keys and value sweeps dominate; for mixed access the interleaved
+// HashMap stays the better default. There is no pair iterator for the same reason, use GetKeys
+// and GetValues (same index in both, stable until the next insert or erase).
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+struct SoAHashMap : taHash
+{
+	static_assert(!cIsVoid<taValue>); // A set has no values to split, use HashSet.
+
+	using InsertResult = SoAInsertResult<taKey, taValue>;
+
+	// Default
+	SoAHashMap() = default;
+	~SoAHashMap() = default;
+
+	// Move
+	SoAHashMap(SoAHashMap&&) = default;
+	SoAHashMap& operator=(SoAHashMap&&) = default;
+
+	// Copy
+	SoAHashMap(const SoAHashMap& inOther) { *this = inOther; }
+	SoAHashMap& operator=(const SoAHashMap& inOther)
+	{
+		Clear();
+
+		mKeys.Reserve(inOther.mKeys.Capacity());
+		mValues.Reserve(inOther.mValues.Capacity());
+		mBuckets.Reserve(inOther.mBuckets.Capacity());
+
+		mKeys    = inOther.mKeys;
+		mValues  = inOther.mValues;
+		mBuckets = inOther.mBuckets;
+
+		return *this;
+	}
+
+	void Clear()
+	{
+		mKeys.Clear();
+		mValues.Clear();
+		mBuckets.Clear();
+		mBuckets.Resize(mBuckets.Capacity());
+	}
+
+	bool Empty() const { return mKeys.Empty(); }
+	bool IsFull() const { return mKeys.Size() == mKeys.Capacity(); }
+
+	int Size() const { return mKeys.Size(); }
+	int Capacity() const { return mKeys.Capacity(); }
+
+	// The parallel arrays. The same index in both is the same entry; indices are stable until the
+	// next insert or erase.
+	Span<const taKey>   GetKeys() const { return mKeys; }
+	Span<const taValue> GetValues() const { return mValues; }
+	Span<taValue>       GetValues() { return mValues; }
+
+	// Find (non-const) ---------------------------------------
+
+	taValue* Find(const taKey& inKey) { return FindInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	taValue* Find(const taAltKey& inKey) { return FindInternal(inKey); }
+
+	// Find (const) -------------------------------------------
+
+	const taValue* Find(const taKey& inKey) const { return const_cast<SoAHashMap*>(this)->FindInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	const taValue* Find(const taAltKey& inKey) const { return const_cast<SoAHashMap*>(this)->FindInternal(inKey); }
+
+	// Contains -----------------------------------------------
+
+	bool Contains(const taKey& inKey) const { return Find(inKey) != nullptr; }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Contains(const taAltKey& inKey) const { return Find(inKey) != nullptr; }
+
+	// Insert -------------------------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(const taKey& inKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(taKey&& ioKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// InsertOrAssign -----------------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(const taKey& inKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(taKey&& ioKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Emplace ------------------------------------------------
+
+	template <typename... taArgs>
+	InsertResult Emplace(const taKey& inKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taArgs>(ioArgs)...);
+	}
+
+	template <typename... taArgs>
+	InsertResult Emplace(taKey&& ioKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taArgs>(ioArgs)...);
+	}
+
+	// Operator[] ---------------------------------------------
+
+	taValue& operator[](const taKey& inKey) { return EmplaceInternal<EReplaceExisting::No>(inKey).mValue; }
+	taValue& operator[](taKey&& ioKey) { return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey)).mValue; }
+
+	// Erase --------------------------------------------------
+
+	bool Erase(const taKey& inKey) { return EraseInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Erase(const taAltKey& inKey) { return EraseInternal(inKey); }
+
+	// Reserve ------------------------------------------------
+
+	void Reserve(int inCapacity)
+	{
+		if (inCapacity <= Capacity())
+			return;
+
+		// Same sizing rules as HashMap: pow2 buckets, ~80% max load.
+		int new_buckets_size = (int)gGetNextPow2(inCapacity);
+
+		int num_key_values = new_buckets_size * 13 / 16; // 13/16 = 0.8125
+		if (num_key_values < inCapacity)
+			new_buckets_size *= 2;
+
+		Grow(new_buckets_size);
+	}
+
+private:
+	using Bucket = Details::HashMapBucket;
+
+	int GetBucketSizeMask() const
+	{
+		gAssert(!mBuckets.Empty());
+		return mBuckets.Size() - 1;
+	}
+
+	void Grow(int inNumBuckets)
+	{
+		gAssert(inNumBuckets == 0 || gIsPow2(inNumBuckets));
+		gAssert(inNumBuckets == 0 || inNumBuckets > mBuckets.Size());
+
+		int new_buckets_size    = gMax(inNumBuckets, 16);
+		int new_key_values_size = new_buckets_size * 13 / 16; // 13/16 = 0.8125
+
+		// Free the buckets first to make sure the TempAllocator can grow the key allocation.
+		mBuckets.ClearAndFreeMemory();
+		mKeys.Reserve(new_key_values_size);
+		mValues.Reserve(new_key_values_size);
+
+		// Re-allocate the buckets.
+		mBuckets.Resize(new_buckets_size);
+
+		// Fill the buckets.
+		for (int i = 0, n = mKeys.Size(); i < n; i++)
+		{
+			// Note: We know the key is not already present so we can skip some compares.
+			bool key_may_be_found = false;
+			auto [bucket_index, distance_and_fingerprint, _] = FindBucket(mKeys[i], key_may_be_found);
+
+			InsertBucket({ distance_and_fingerprint, i }, bucket_index);
+		}
+	}
+
+	template <typename taAltKey>
+	taValue* FindInternal(const taAltKey& inKey)
+	{
+		if (Empty()) [[unlikely]]
+			return nullptr;
+
+		auto [bucket_index, _, found] = FindBucket(inKey);
+
+		if (found)
+			return &mValues[mBuckets[bucket_index].mKeyValueIndex];
+
+		return nullptr;
+	}
+
+	enum class EReplaceExisting
+	{
+		No,
+		Yes,
+	};
+
+	template <EReplaceExisting taReplaceExisting, typename taAltKey, typename... taArgs>
+	InsertResult EmplaceInternal(taAltKey&& ioKey, taArgs&&... ioArgs)
+	{
+		if (IsFull()) [[unlikely]]
+			Grow(mBuckets.Size() * 2);
+
+		auto [bucket_index, distance_and_fingerprint, found] = FindBucket(ioKey);
+
+		if (found)
+		{
+			// Key already exists.
+			int index = mBuckets[bucket_index].mKeyValueIndex;
+
+			if constexpr (taReplaceExisting == EReplaceExisting::No)
+			{
+				return { mKeys[index], mValues[index], EInsertResult::Found };
+			}
+			else
+			{
+				mValues[index] = { gForward<taArgs>(ioArgs)... };
+				return { mKeys[index], mValues[index], EInsertResult::Replaced };
+			}
+		}
+
+		// Key does not exist, add it to both arrays.
+		mKeys.EmplaceBack(gForward<taAltKey>(ioKey));
+		mValues.EmplaceBack(gForward<taArgs>(ioArgs)...);
+
+		InsertBucket({ distance_and_fingerprint, mKeys.Size() - 1 }, bucket_index);
+
+		return { mKeys.Back(), mValues.Back(), EInsertResult::Added };
+	}
+
+	template <typename taAltKey>
+	bool EraseInternal(const taAltKey& inKey)
+	{
+		if (Empty()) [[unlikely]]
+			return false;
+
+		auto [bucket_index, distance_and_fingerprint, found] = FindBucket(inKey);
+
+		if (found == false)
+			return false;
+
+		int index_to_erase = mBuckets[bucket_index].mKeyValueIndex;
+
+		EraseBucket(bucket_index);
+
+		// If the entry to erase is the last one, pop it and we're done.
+		if (index_to_erase == mKeys.Size() - 1)
+		{
+			mKeys.PopBack();
+			mValues.PopBack();
+			return true;
+		}
+
+		// Otherwise swap it with the last one. Finding the bucket of the swapped key only scans
+		// the keys array, the values are never touched.
+		int last_index = mKeys.Size() - 1;
+
+		const uint64 hash         = taHash::operator()(mKeys[last_index]);
+		const int    buckets_mask = GetBucketSizeMask();
+		bucket_index              = (int)hash & buckets_mask;
+
+		while (true)
+		{
+			Bucket& bucket = mBuckets[bucket_index];
+
+			if (bucket.mKeyValueIndex == last_index)
+			{
+				gAssert(bucket.mDistanceAndFingerprint != 0); // We should never encounter an empty bucket.
+
+				bucket.mKeyValueIndex = index_to_erase;
+				break;
+			}
+
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+
+		mKeys.SwapErase(index_to_erase);
+		mValues.SwapErase(index_to_erase);
+
+		return true;
+	}
+
+	struct FindBucketResult
+	{
+		int    mBucketIndex;
+		uint32 mDistanceAndFingerprint;
+		bool   mFoundKey;
+	};
+
+	// Find the bucket where a key is (or should be). Same Robin Hood probe as HashMap, except key
+	// compares read the keys array only.
+	template <typename taAltKey>
+	FindBucketResult FindBucket(const taAltKey& inKey, bool inKeyMayBeFound = true) const
+	{
+		const uint64 hash         = taHash::operator()(inKey);
+		const int    buckets_mask = GetBucketSizeMask();
+		int          bucket_index = (int)hash & buckets_mask;
+
+		uint32 distance_and_fingerprint = Bucket::sGetDistanceAndFingerprint(hash);
+
+		while (true)
+		{
+			Bucket bucket = mBuckets[bucket_index];
+
+			if (inKeyMayBeFound && bucket.mDistanceAndFingerprint == distance_and_fingerprint) [[likely]]
+			{
+				if (mKeys[bucket.mKeyValueIndex] == inKey) [[likely]]
+					return { bucket_index, distance_and_fingerprint, true };
+			}
+			else if (bucket.mDistanceAndFingerprint < distance_and_fingerprint)
+			{
+				return { bucket_index, distance_and_fingerprint, false };
+			}
+
+			distance_and_fingerprint += Bucket::cDistanceIncrement;
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+	}
+
+	// Insert a bucket at this index and move the existing buckets to the right.
+	void InsertBucket(Bucket inBucket, int inIndex)
+	{
+		Bucket    bucket       = inBucket;
+		int       bucket_index = inIndex;
+		const int buckets_mask = GetBucketSizeMask();
+		while (true)
+		{
+			gSwap(mBuckets[bucket_index], bucket);
+
+			if (bucket.mDistanceAndFingerprint == 0)
+				break;
+
+			bucket.mDistanceAndFingerprint += Bucket::cDistanceIncrement;
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+	}
+
+	// Erase the bucket at this index and move the following buckets to the left if needed.
+	void EraseBucket(int inIndex)
+	{
+		int       bucket_index = inIndex;
+		const int buckets_mask = GetBucketSizeMask();
+
+		while (true)
+		{
+			int    next_bucket_index = (bucket_index + 1) & buckets_mask;
+			Bucket next_bucket       = mBuckets[next_bucket_index];
+
+			if (next_bucket.mDistanceAndFingerprint < 2 * Bucket::cDistanceIncrement)
+				break;
+
+			next_bucket.mDistanceAndFingerprint -= Bucket::cDistanceIncrement;
+			mBuckets[bucket_index] = next_bucket;
+
+			bucket_index = next_bucket_index;
+		}
+
+		mBuckets[bucket_index] = {};
+	}
+
+	using KeyVector    = Vector<taKey, taAllocator<taKey>>;
+	using ValueVector  = Vector<taValue, taAllocator<taValue>>;
+	using BucketVector = Vector<Bucket, taAllocator<Bucket>>;
+
+	KeyVector    mKeys;    // Keys stored in a dense array (probing and erase back-fill only read this).
+	ValueVector  mValues;  // Values stored in a parallel dense array.
+	BucketVector mBuckets; // Bucket metadata.
+};
+
+
+// Alias for a SoAHashMap using the TempAllocator.
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>
+>
+using TempSoAHashMap = SoAHashMap<taKey, taValue, taHash, TempAllocator>;
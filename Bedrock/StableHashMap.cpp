@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/StableHashMap.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/String.h>
+#include <Bedrock/Random.h>
+
+
+REGISTER_TEST("StableHashMap")
+{
+	StableHashMap<String, String> map;
+
+	auto bread = map.Insert("bread", "butter");
+	auto toast = map.Insert("toast", "jam");
+	auto bun   = map.Insert("bun", "burger");
+	TEST_TRUE(bread.mResult == EInsertResult::Added);
+	TEST_TRUE(map.Size() == 3);
+
+	TEST_TRUE(map.Insert("bread", "jam").mResult == EInsertResult::Found);
+	TEST_TRUE(map.Insert("bread", "jam").mIndex == bread.mIndex);
+	TEST_TRUE(map.InsertOrAssign("bread", "honey").mResult == EInsertResult::Replaced);
+	TEST_TRUE(map.InsertOrAssign("bread", "honey").mIndex == bread.mIndex); // Replacing doesn't move the entry.
+
+	// Indices can be used instead of re-finding the key.
+	TEST_TRUE(map.FindIndex("bread") == bread.mIndex);
+	TEST_TRUE(map.At(bread.mIndex).mKey == "bread");
+	TEST_TRUE(map.At(bread.mIndex).mValue == "honey");
+	TEST_TRUE(map.FindIndex("broad") == map.cInvalidIndex);
+
+	// Transparent lookups work without building a String.
+	TEST_TRUE(map.FindIndex(StringView("toast")) == toast.mIndex);
+	TEST_TRUE(map.Contains(StringView("bun")));
+
+	// Erasing leaves a hole; the other indices are untouched.
+	TEST_TRUE(map.Erase("toast"));
+	TEST_FALSE(map.Erase("toast"));
+	TEST_FALSE(map.IsValidIndex(toast.mIndex));
+	TEST_TRUE(map.FindIndex("bread") == bread.mIndex);
+	TEST_TRUE(map.FindIndex("bun") == bun.mIndex);
+	TEST_TRUE(map.Size() == 2);
+
+	// The next insert recycles the hole.
+	auto brioche = map.Insert("brioche", "peanut butter");
+	TEST_TRUE(brioche.mResult == EInsertResult::Added);
+	TEST_TRUE(brioche.mIndex == toast.mIndex);
+
+	// Iteration skips the holes.
+	map.Erase("bun");
+	int num_visited = 0;
+	for (const auto& key_value : map)
+	{
+		TEST_TRUE(map.FindIndex(key_value.mKey) != map.cInvalidIndex);
+		num_visited++;
+	}
+	TEST_TRUE(num_visited == map.Size());
+
+	// Erasing by index works too.
+	map.EraseAt(brioche.mIndex);
+	TEST_TRUE(map.Find("brioche") == nullptr);
+	TEST_TRUE(map.Size() == 1);
+
+	// Copies keep the same indices (holes included).
+	StableHashMap<String, String> copy = map;
+	TEST_TRUE(copy.FindIndex("bread") == bread.mIndex);
+	copy["bagel"] = "cream cheese";
+	TEST_TRUE(map.Find("bagel") == nullptr);
+
+	map.Clear();
+	TEST_TRUE(map.Empty());
+	TEST_FALSE(map.IsValidIndex(bread.mIndex));
+
+	// Indices survive growth: growing only rebuilds the bucket metadata.
+	StableHashMap<int, int> grown;
+	auto first = grown.Insert(0, 0);
+	for (int i = 1; i < 100; i++)
+		grown.Insert(i, i);
+	TEST_TRUE(grown.FindIndex(0) == first.mIndex);
+	TEST_TRUE(grown.At(first.mIndex).mValue == 0);
+};
+
+
+REGISTER_TEST("Large StableHashMap")
+{
+	// Mirror every operation into a HashMap and check they never disagree. Also record the stable
+	// index of every key at insert time to check none of them moved, despite erases and growths.
+	StableHashMap<uint32, int> map;
+	HashMap<uint32, int>       reference;
+	HashMap<uint32, int>       indices;
+
+	int rand_seed = 42;
+	for (int i = 0; i < 10000; i++)
+	{
+		rand_seed  = gRand32(rand_seed);
+		uint32 key = (uint32)rand_seed % 2000; // Force collisions, replacements and erases.
+
+		switch (rand_seed % 3)
+		{
+		case 0:
+		{
+			auto result = map.InsertOrAssign(key, i);
+			TEST_TRUE(result.mResult == reference.InsertOrAssign(key, i).mResult);
+
+			if (result.mResult == EInsertResult::Added)
+				indices[key] = result.mIndex;
+			else
+				TEST_TRUE(indices[key] == result.mIndex);
+			break;
+		}
+		case 1:
+		{
+			auto result = map.Insert(key, i);
+			TEST_TRUE(result.mResult == reference.Insert(key, i).mResult);
+
+			if (result.mResult == EInsertResult::Added)
+				indices[key] = result.mIndex;
+			break;
+		}
+		case 2:
+			TEST_TRUE(map.Erase(key) == reference.Erase(key));
+			indices.Erase(key);
+			break;
+		}
+	}
+
+	TEST_TRUE(map.Size() == reference.Size());
+	for (const auto& key_value : reference)
+	{
+		int index = indices.Find(key_value.mKey)->mValue;
+		TEST_TRUE(map.FindIndex(key_value.mKey) == index);
+		TEST_TRUE(map.At(index).mKey == key_value.mKey);
+		TEST_TRUE(map.At(index).mValue == key_value.mValue);
+	}
+};
+
+
+REGISTER_TEST("Large Temp StableHashMap")
+{
+	TEST_INIT_TEMP_MEMORY(100_KiB);
+
+	TempStableHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++)
+		map.Insert(i, i * 2);
+
+	// Erase every other key, the rest keeps its index.
+	for (int i = 0; i < 1000; i += 2)
+		map.Erase(i);
+
+	for (int i = 1; i < 1000; i += 2)
+		TEST_TRUE(map.At(map.FindIndex(i)).mValue == i * 2);
+};
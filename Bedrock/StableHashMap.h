@@ -0,0 +1,579 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/HashMap.h> // For KeyValue, Details::HashMapBucket and EInsertResult.
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Vector.h>
+
+
+template <typename taKey, typename taValue>
+struct StableInsertResult
+{
+	StableInsertResult(KeyValue<taKey, taValue>& ioKeyValue, int inIndex, EInsertResult inResult)
+		: mKey(ioKeyValue.mKey), mValue(ioKeyValue.mValue), mIndex(inIndex), mResult(inResult)
+	{}
+
+	const taKey&  mKey;
+	taValue&      mValue;
+	int           mIndex;	// Stable index of the key-value (see StableHashMap::At).
+	EInsertResult mResult;
+};
+
+
+// HashMap variant with stable key-value indices.
+// Erase leaves a hole in the key-value array and links it into a free list instead of back-swapping
+// the last entry, so the index of a key-value never changes as long as it is in the map (not even
+// when the map grows: growing only re-fills the bucket metadata). Other data structures can thus
+// hold 32-bit indices into the map (from FindIndex or InsertResult::mIndex) and access key-values
+// directly with At, skipping the hash-probe of a Find. Inserts recycle the holes before growing
+// the array. In exchange iteration has to skip the holes, so a heavily-erased-from map iterates
+// slower than a dense HashMap.
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+struct StableHashMap : taHash
+{
+	static_assert(!cIsVoid<taValue>); // Stable indices make no sense without values to point at, use HashSet.
+
+	using KeyValue = KeyValue<taKey, taValue>;
+	using InsertResult = StableInsertResult<taKey, taValue>;
+
+	static constexpr int cInvalidIndex = -1; // Returned by FindIndex when the key isn't in the map.
+
+	// Default
+	StableHashMap() = default;
+	~StableHashMap() = default;
+
+	// Move
+	StableHashMap(StableHashMap&& ioOther) { *this = gMove(ioOther); }
+	StableHashMap& operator=(StableHashMap&& ioOther)
+	{
+		mSlots   = gMove(ioOther.mSlots);
+		mBuckets = gMove(ioOther.mBuckets);
+
+		mFirstFreeIndex         = ioOther.mFirstFreeIndex;
+		mNumFreeSlots           = ioOther.mNumFreeSlots;
+		ioOther.mFirstFreeIndex = cInvalidIndex;
+		ioOther.mNumFreeSlots   = 0;
+
+		return *this;
+	}
+
+	// Copy
+	StableHashMap(const StableHashMap& inOther) { *this = inOther; }
+	StableHashMap& operator=(const StableHashMap& inOther)
+	{
+		Clear();
+
+		mSlots.Reserve(inOther.mSlots.Capacity());
+		mBuckets.Reserve(inOther.mBuckets.Capacity());
+
+		// The holes are copied as-is, so the free list and all stable indices stay valid.
+		mSlots   = inOther.mSlots;
+		mBuckets = inOther.mBuckets;
+
+		mFirstFreeIndex = inOther.mFirstFreeIndex;
+		mNumFreeSlots   = inOther.mNumFreeSlots;
+
+		return *this;
+	}
+
+	void Clear()
+	{
+		mSlots.Clear();
+		mFirstFreeIndex = cInvalidIndex;
+		mNumFreeSlots   = 0;
+
+		mBuckets.Clear();
+		mBuckets.Resize(mBuckets.Capacity());
+	}
+
+	bool Empty() const { return Size() == 0; }
+	bool IsFull() const { return mFirstFreeIndex == cInvalidIndex && mSlots.Size() == mSlots.Capacity(); }
+
+	int Size() const { return mSlots.Size() - mNumFreeSlots; }
+	int Capacity() const { return mSlots.Capacity(); }
+
+	// Stable index access ------------------------------------
+
+	// Return true if inIndex refers to a key-value currently in the map.
+	bool IsValidIndex(int inIndex) const
+	{
+		return inIndex >= 0 && inIndex < mSlots.Size() && mSlots[inIndex].IsUsed();
+	}
+
+	// Get the key-value at a stable index (from FindIndex or an InsertResult).
+	KeyValue& At(int inIndex)
+	{
+		gAssert(IsValidIndex(inIndex));
+		return mSlots[inIndex].mKeyValue;
+	}
+
+	const KeyValue& At(int inIndex) const
+	{
+		gAssert(IsValidIndex(inIndex));
+		return mSlots[inIndex].mKeyValue;
+	}
+
+	// FindIndex ----------------------------------------------
+
+	// Find a key. Returns its stable index, or cInvalidIndex if the key isn't in the map.
+	int FindIndex(const taKey& inKey) const { return FindIndexInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	int FindIndex(const taAltKey& inKey) const { return FindIndexInternal(inKey); }
+
+	// Find (non-const) ---------------------------------------
+
+	taValue* Find(const taKey& inKey) { return FindInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	taValue* Find(const taAltKey& inKey) { return FindInternal(inKey); }
+
+	// Find (const) -------------------------------------------
+
+	const taValue* Find(const taKey& inKey) const { return const_cast<StableHashMap*>(this)->FindInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	const taValue* Find(const taAltKey& inKey) const { return const_cast<StableHashMap*>(this)->FindInternal(inKey); }
+
+	// Contains -----------------------------------------------
+
+	bool Contains(const taKey& inKey) const { return FindIndexInternal(inKey) != cInvalidIndex; }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Contains(const taAltKey& inKey) const { return FindIndexInternal(inKey) != cInvalidIndex; }
+
+	// Insert -------------------------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(const taKey& inKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(taKey&& ioKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// InsertOrAssign -----------------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(const taKey& inKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(taKey&& ioKey, taAltValue&& ioValue)
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Emplace ------------------------------------------------
+
+	template <typename... taArgs>
+	InsertResult Emplace(const taKey& inKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taArgs>(ioArgs)...);
+	}
+
+	template <typename... taArgs>
+	InsertResult Emplace(taKey&& ioKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taArgs>(ioArgs)...);
+	}
+
+	// Operator[] ---------------------------------------------
+
+	taValue& operator[](const taKey& inKey) { return EmplaceInternal<EReplaceExisting::No>(inKey).mValue; }
+	taValue& operator[](taKey&& ioKey) { return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey)).mValue; }
+
+	// Erase --------------------------------------------------
+
+	bool Erase(const taKey& inKey) { return EraseInternal(inKey); }
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Erase(const taAltKey& inKey) { return EraseInternal(inKey); }
+
+	// Erase by stable index. The index (and any copy of it held elsewhere) becomes invalid.
+	void EraseAt(int inIndex)
+	{
+		gAssert(IsValidIndex(inIndex));
+
+		// Find the bucket pointing at this slot, starting from the key's ideal bucket.
+		// Note: The key is present, so its bucket comes before any empty bucket on the probe path.
+		const uint64 hash         = taHash::operator()(mSlots[inIndex].mKeyValue.mKey);
+		const int    buckets_mask = GetBucketSizeMask();
+		int          bucket_index = (int)hash & buckets_mask;
+
+		while (true)
+		{
+			Bucket& bucket = mBuckets[bucket_index];
+
+			if (bucket.mKeyValueIndex == inIndex)
+			{
+				gAssert(bucket.mDistanceAndFingerprint != 0); // We should never encounter an empty bucket.
+				break;
+			}
+
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+
+		EraseBucket(bucket_index);
+		FreeSlot(inIndex);
+	}
+
+	// Reserve ------------------------------------------------
+
+	void Reserve(int inCapacity)
+	{
+		if (inCapacity <= Capacity())
+			return;
+
+		// Same sizing rules as HashMap: pow2 buckets, ~80% max load.
+		int new_buckets_size = (int)gGetNextPow2(inCapacity);
+
+		int num_key_values = new_buckets_size * 13 / 16; // 13/16 = 0.8125
+		if (num_key_values < inCapacity)
+			new_buckets_size *= 2;
+
+		Grow(new_buckets_size);
+	}
+
+private:
+	using Bucket = Details::HashMapBucket;
+
+	// A slot either holds a live key-value, or is a hole linked into the free list.
+	// The key-value lifetime is managed manually so that holes don't contain objects at all
+	// (no default-constructible requirement, no destructor ordering surprises).
+	struct Slot
+	{
+		static constexpr int cUsedIndex = -2; // Value of mNextFreeIndex when the slot holds a key-value.
+
+		Slot() {}
+		~Slot()
+		{
+			if (IsUsed())
+				mKeyValue.~KeyValue();
+		}
+
+		Slot(const Slot& inOther)
+			: mNextFreeIndex(inOther.mNextFreeIndex)
+		{
+			if (IsUsed())
+				gPlacementNew(mKeyValue, inOther.mKeyValue);
+		}
+
+		Slot(Slot&& ioOther)
+			: mNextFreeIndex(ioOther.mNextFreeIndex)
+		{
+			if (IsUsed())
+				gPlacementNew(mKeyValue, gMove(ioOther.mKeyValue));
+		}
+
+		// Not assignable (Vector only needs construction and destruction).
+		Slot& operator=(const Slot&) = delete;
+		Slot& operator=(Slot&&)      = delete;
+
+		bool IsUsed() const { return mNextFreeIndex == cUsedIndex; }
+
+		union { KeyValue mKeyValue; };	// Only constructed while the slot is used.
+		int mNextFreeIndex = cInvalidIndex;	// cUsedIndex when used, otherwise the next free slot.
+	};
+
+public:
+	// Iteration, skipping the holes. Indices are not iteration order; use FindIndex/At for those.
+	template <typename taQualifiedSlot, typename taQualifiedKeyValue>
+	struct IterBase
+	{
+		taQualifiedKeyValue& operator*() const { return mSlot->mKeyValue; }
+		taQualifiedKeyValue* operator->() const { return &mSlot->mKeyValue; }
+
+		IterBase& operator++()
+		{
+			mSlot++;
+			SkipFreeSlots();
+			return *this;
+		}
+
+		bool operator==(const IterBase& inOther) const { return mSlot == inOther.mSlot; }
+
+		void SkipFreeSlots()
+		{
+			while (mSlot != mEnd && !mSlot->IsUsed())
+				mSlot++;
+		}
+
+		taQualifiedSlot* mSlot = nullptr;
+		taQualifiedSlot* mEnd  = nullptr;
+	};
+
+	using Iter = IterBase<Slot, KeyValue>;
+	using ConstIter = IterBase<const Slot, const KeyValue>;
+
+	Iter Begin() { Iter iter = { mSlots.Begin(), mSlots.End() }; iter.SkipFreeSlots(); return iter; }
+	Iter End() { return { mSlots.End(), mSlots.End() }; }
+	ConstIter Begin() const { ConstIter iter = { mSlots.Begin(), mSlots.End() }; iter.SkipFreeSlots(); return iter; }
+	ConstIter End() const { return { mSlots.End(), mSlots.End() }; }
+	Iter begin() { return Begin(); }
+	Iter end() { return End(); }
+	ConstIter begin() const { return Begin(); }
+	ConstIter end() const { return End(); }
+
+private:
+	int GetBucketSizeMask() const
+	{
+		gAssert(!mBuckets.Empty());
+		return mBuckets.Size() - 1;
+	}
+
+	void Grow(int inNumBuckets)
+	{
+		gAssert(inNumBuckets == 0 || gIsPow2(inNumBuckets));
+		gAssert(inNumBuckets == 0 || inNumBuckets > mBuckets.Size());
+
+		int new_buckets_size    = gMax(inNumBuckets, 16);
+		int new_key_values_size = new_buckets_size * 13 / 16; // 13/16 = 0.8125
+
+		// Free the buckets first to make sure the TempAllocator can grow the slots allocation.
+		mBuckets.ClearAndFreeMemory();
+		mSlots.Reserve(new_key_values_size);
+
+		// Re-allocate the buckets.
+		mBuckets.Resize(new_buckets_size);
+
+		// Fill the buckets. Slot indices don't change, only the bucket metadata is rebuilt.
+		for (int i = 0, n = mSlots.Size(); i < n; i++)
+		{
+			if (!mSlots[i].IsUsed())
+				continue;
+
+			// Note: We know the key is not already present so we can skip some compares.
+			bool key_may_be_found = false;
+			auto [bucket_index, distance_and_fingerprint, _] = FindBucket(mSlots[i].mKeyValue.mKey, key_may_be_found);
+
+			InsertBucket({ distance_and_fingerprint, i }, bucket_index);
+		}
+	}
+
+	template <typename taAltKey>
+	int FindIndexInternal(const taAltKey& inKey) const
+	{
+		if (Empty()) [[unlikely]]
+			return cInvalidIndex;
+
+		auto [bucket_index, _, found] = FindBucket(inKey);
+
+		if (found)
+			return mBuckets[bucket_index].mKeyValueIndex;
+
+		return cInvalidIndex;
+	}
+
+	template <typename taAltKey>
+	taValue* FindInternal(const taAltKey& inKey)
+	{
+		int index = FindIndexInternal(inKey);
+
+		if (index == cInvalidIndex)
+			return nullptr;
+
+		return &mSlots[index].mKeyValue.mValue;
+	}
+
+	enum class EReplaceExisting
+	{
+		No,
+		Yes,
+	};
+
+	template <EReplaceExisting taReplaceExisting, typename taAltKey, typename... taArgs>
+	InsertResult EmplaceInternal(taAltKey&& ioKey, taArgs&&... ioArgs)
+	{
+		if (IsFull()) [[unlikely]]
+			Grow(mBuckets.Size() * 2);
+
+		auto [bucket_index, distance_and_fingerprint, found] = FindBucket(ioKey);
+
+		if (found)
+		{
+			// Key already exists.
+			int       index     = mBuckets[bucket_index].mKeyValueIndex;
+			KeyValue& key_value = mSlots[index].mKeyValue;
+
+			if constexpr (taReplaceExisting == EReplaceExisting::No)
+			{
+				return { key_value, index, EInsertResult::Found };
+			}
+			else
+			{
+				key_value.mValue = { gForward<taArgs>(ioArgs)... };
+				return { key_value, index, EInsertResult::Replaced };
+			}
+		}
+
+		// Key does not exist, add it in a recycled hole if there is one.
+		int index;
+		if (mFirstFreeIndex != cInvalidIndex)
+		{
+			index           = mFirstFreeIndex;
+			mFirstFreeIndex = mSlots[index].mNextFreeIndex;
+			mNumFreeSlots--;
+		}
+		else
+		{
+			mSlots.EmplaceBack();
+			index = mSlots.Size() - 1;
+		}
+
+		Slot& slot = mSlots[index];
+		gPlacementNew(slot.mKeyValue, gForward<taAltKey>(ioKey), gForward<taArgs>(ioArgs)...);
+		slot.mNextFreeIndex = Slot::cUsedIndex;
+
+		InsertBucket({ distance_and_fingerprint, index }, bucket_index);
+
+		return { slot.mKeyValue, index, EInsertResult::Added };
+	}
+
+	template <typename taAltKey>
+	bool EraseInternal(const taAltKey& inKey)
+	{
+		if (Empty()) [[unlikely]]
+			return false;
+
+		auto [bucket_index, distance_and_fingerprint, found] = FindBucket(inKey);
+
+		if (found == false)
+			return false;
+
+		// No back-swap of the last entry: the slot becomes a hole and every other index stays valid.
+		int index = mBuckets[bucket_index].mKeyValueIndex;
+
+		EraseBucket(bucket_index);
+		FreeSlot(index);
+
+		return true;
+	}
+
+	// Destroy the key-value at inIndex and link the slot into the free list.
+	void FreeSlot(int inIndex)
+	{
+		Slot& slot = mSlots[inIndex];
+
+		slot.mKeyValue.~KeyValue();
+		slot.mNextFreeIndex = mFirstFreeIndex;
+		mFirstFreeIndex     = inIndex;
+		mNumFreeSlots++;
+	}
+
+	struct FindBucketResult
+	{
+		int    mBucketIndex;			// The bucket where the key is or should be inserted.
+		uint32 mDistanceAndFingerprint; // The distance and fingerprint of the key for this bucket.
+		bool   mFoundKey;				// True if the key was found at this bucket.
+	};
+
+	// Find the bucket where a key is (or should be). Same Robin Hood probe as HashMap.
+	template <typename taAltKey>
+	FindBucketResult FindBucket(const taAltKey& inKey, bool inKeyMayBeFound = true) const
+	{
+		const uint64 hash         = taHash::operator()(inKey);
+		const int    buckets_mask = GetBucketSizeMask();
+		int          bucket_index = (int)hash & buckets_mask;
+
+		uint32 distance_and_fingerprint = Bucket::sGetDistanceAndFingerprint(hash);
+
+		while (true)
+		{
+			Bucket bucket = mBuckets[bucket_index];
+
+			if (inKeyMayBeFound && bucket.mDistanceAndFingerprint == distance_and_fingerprint) [[likely]]
+			{
+				if (mSlots[bucket.mKeyValueIndex].mKeyValue.mKey == inKey) [[likely]]
+					return { bucket_index, distance_and_fingerprint, true };
+			}
+			else if (bucket.mDistanceAndFingerprint < distance_and_fingerprint)
+			{
+				return { bucket_index, distance_and_fingerprint, false };
+			}
+
+			distance_and_fingerprint += Bucket::cDistanceIncrement;
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+	}
+
+	// Insert a bucket at this index and move the existing buckets to the right.
+	void InsertBucket(Bucket inBucket, int inIndex)
+	{
+		Bucket    bucket       = inBucket;
+		int       bucket_index = inIndex;
+		const int buckets_mask = GetBucketSizeMask();
+		while (true)
+		{
+			gSwap(mBuckets[bucket_index], bucket);
+
+			if (bucket.mDistanceAndFingerprint == 0)
+				break;
+
+			bucket.mDistanceAndFingerprint += Bucket::cDistanceIncrement;
+			bucket_index = (bucket_index + 1) & buckets_mask;
+		}
+	}
+
+	// Erase the bucket at this index and move the following buckets to the left if needed.
+	void EraseBucket(int inIndex)
+	{
+		int       bucket_index = inIndex;
+		const int buckets_mask = GetBucketSizeMask();
+
+		while (true)
+		{
+			int    next_bucket_index = (bucket_index + 1) & buckets_mask;
+			Bucket next_bucket       = mBuckets[next_bucket_index];
+
+			if (next_bucket.mDistanceAndFingerprint < 2 * Bucket::cDistanceIncrement)
+				break;
+
+			next_bucket.mDistanceAndFingerprint -= Bucket::cDistanceIncrement;
+			mBuckets[bucket_index] = next_bucket;
+
+			bucket_index = next_bucket_index;
+		}
+
+		mBuckets[bucket_index] = {};
+	}
+
+	using SlotVector   = Vector<Slot, taAllocator<Slot>>;
+	using BucketVector = Vector<Bucket, taAllocator<Bucket>>;
+
+	SlotVector   mSlots;						 // Key-values and holes; a key-value never moves inside this array.
+	BucketVector mBuckets;						 // Bucket metadata.
+	int          mFirstFreeIndex = cInvalidIndex; // Head of the free list threaded through the holes.
+	int          mNumFreeSlots   = 0;			 // Number of holes in mSlots.
+};
+
+
+// Alias for a StableHashMap using the TempAllocator.
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>
+>
+using TempStableHashMap = StableHashMap<taKey, taValue, taHash, TempAllocator>;
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/StaticHashMap.h>
+
+#include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+
+
+// The whole point: the table is built at compile time and lookups of constant keys fold away.
+constexpr KeyValue<StringView, int> cOpcodes[] =
+{
+	{ "nop", 0 }, { "add", 1 }, { "sub", 2 }, { "mul", 3 }, { "div", 4 },
+	{ "load", 5 }, { "store", 6 }, { "jump", 7 }, { "call", 8 }, { "ret", 9 },
+};
+constexpr StaticHashMap cOpcodeMap(cOpcodes);
+
+static_assert(cOpcodeMap.Size() == 10);
+static_assert(*cOpcodeMap.Find("add") == 1);
+static_assert(*cOpcodeMap.Find("ret") == 9);
+static_assert(cOpcodeMap.Find("madd") == nullptr);
+static_assert(cOpcodeMap.Contains("store"));
+static_assert(!cOpcodeMap.Contains(""));
+
+
+REGISTER_TEST("StaticHashMap")
+{
+	// Runtime lookups on the compile-time table.
+	for (const KeyValue<StringView, int>& key_value : cOpcodes)
+	{
+		const int* value = cOpcodeMap.Find(key_value.mKey);
+		TEST_TRUE(value != nullptr);
+		TEST_TRUE(*value == key_value.mValue);
+	}
+	TEST_TRUE(cOpcodeMap.Find("frobnicate") == nullptr);
+
+	// Iteration is in construction order.
+	int index = 0;
+	for (const KeyValue<StringView, int>& key_value : cOpcodeMap)
+		TEST_TRUE(key_value.mValue == cOpcodes[index++].mValue);
+	TEST_TRUE(index == 10);
+
+	// Integer keys work too.
+	constexpr KeyValue<uint32, StringView> cStages[] =
+	{
+		{ 0x1000, "vertex" }, { 0x2000, "pixel" }, { 0x3000, "compute" },
+	};
+	constexpr StaticHashMap cStageMap(cStages);
+	static_assert(*cStageMap.Find(0x2000) == "pixel");
+	TEST_TRUE(*cStageMap.Find(0x3000) == "compute");
+	TEST_TRUE(cStageMap.Find(0x4000) == nullptr);
+
+	// A single-entry map is the degenerate case of the bucket placement.
+	constexpr KeyValue<int, int> cSingle[] = { { 42, 420 } };
+	constexpr StaticHashMap cSingleMap(cSingle);
+	static_assert(*cSingleMap.Find(42) == 420);
+	static_assert(cSingleMap.Find(43) == nullptr);
+};
+
+
+REGISTER_TEST("StaticHashMap Larger")
+{
+	TEST_INIT_TEMP_MEMORY(10_KiB);
+
+	// A couple hundred keys exercises the displacement search properly. Built at runtime here
+	// (the keys are formatted strings), same code path as the constexpr version.
+	constexpr int cNumKeys = 200;
+
+	TempString keys[cNumKeys];
+	KeyValue<StringView, int> key_values[cNumKeys];
+	for (int i = 0; i < cNumKeys; i++)
+	{
+		keys[i]       = gTempFormat("key_%d", i);
+		key_values[i] = { keys[i], i };
+	}
+
+	StaticHashMap map(key_values);
+
+	for (int i = 0; i < cNumKeys; i++)
+	{
+		const int* value = map.Find(keys[i]);
+		TEST_TRUE(value != nullptr);
+		TEST_TRUE(*value == i);
+	}
+	TEST_TRUE(map.Find("key_200") == nullptr);
+	TEST_TRUE(map.Find("not_a_key") == nullptr);
+};
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/HashMap.h> // For KeyValue.
+#include <Bedrock/StringView.h>
+#include <Bedrock/TypeTraits.h>
+
+
+namespace Details
+{
+	// Constexpr mixer for StaticHashMap (a finalizer-style multiply-xor).
+	// gHash (rapidhash) isn't usable in constant evaluation, and the table construction below
+	// guarantees zero collisions anyway so hash quality only has to be decent.
+	constexpr uint64 gStaticHashMix(uint64 inValue, uint64 inSeed)
+	{
+		uint64 hash = inValue ^ inSeed;
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCD;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53;
+		hash ^= hash >> 33;
+		return hash;
+	}
+
+	// Constexpr hash of a key. Integers and string-like keys are supported.
+	template <typename taKey>
+	constexpr uint64 gStaticHashKey(const taKey& inKey)
+	{
+		if constexpr (cIsIntegral<taKey>)
+		{
+			return gStaticHashMix((uint64)inKey, cHashSeed);
+		}
+		else
+		{
+			// FNV-1a over the characters, then one mix to spread the entropy to all the bits.
+			StringView key  = inKey;
+			uint64     hash = 0xCBF29CE484222325;
+			for (char c : key)
+				hash = (hash ^ (uint8)c) * 0x100000001B3;
+			return gStaticHashMix(hash, cHashSeed);
+		}
+	}
+}
+
+
+// Compile-time perfect-hash map for key sets fixed at compile time (opcode names, config keys...).
+// The constructor searches per-bucket displacement seeds (CHD-style) so that every key lands in
+// its own slot: a lookup is one hash, one seed load and one slot load - no probe loop, no load
+// factor slack, and misses cost a single key compare. Construct it constexpr so the whole search
+// runs at compile time and the table goes in the binary as data; lookups are constexpr too when
+// the key is a constant. Keys must be integers or string-like (convertible to StringView).
+//
+// eg. constexpr KeyValue<StringView, int> cOpcodes[] = { { "add", 0 }, { "sub", 1 } };
+//     constexpr StaticHashMap cOpcodeMap(cOpcodes);
+//     cOpcodeMap.Find("add"); // -> pointer to 0
+template <typename taKey, typename taValue, int taSize>
+struct StaticHashMap
+{
+	static_assert(taSize > 0);
+
+	constexpr StaticHashMap(const KeyValue<taKey, taValue> (&inKeyValues)[taSize])
+	{
+		// Hash every key once and bucket them.
+		uint64 key_hashes[taSize]  = {};
+		int    key_buckets[taSize] = {};
+		int    bucket_sizes[cNumSlots] = {};
+
+		for (int i = 0; i < taSize; i++)
+		{
+			mKeyValues[i]  = inKeyValues[i];
+			key_hashes[i]  = Details::gStaticHashKey(inKeyValues[i].mKey);
+			key_buckets[i] = (int)(key_hashes[i] & cSlotMask);
+			bucket_sizes[key_buckets[i]]++;
+		}
+
+		for (int& index : mSlotIndices)
+			index = -1;
+
+		bool slot_used[cNumSlots] = {};
+
+		// Place buckets from largest to smallest: the big ones need free slots the most.
+		for (int size = taSize; size >= 1; size--)
+		{
+			for (int bucket = 0; bucket < cNumSlots; bucket++)
+			{
+				if (bucket_sizes[bucket] != size)
+					continue;
+
+				// Gather the keys of this bucket.
+				int members[taSize] = {};
+				int num_members     = 0;
+				for (int i = 0; i < taSize; i++)
+					if (key_buckets[i] == bucket)
+						members[num_members++] = i;
+
+				// Find a displacement seed that sends every member to a distinct free slot.
+				// Note: seeds start at 1, 0 is reserved for empty buckets.
+				uint32 seed = 1;
+				while (true)
+				{
+					int  trial_slots[taSize] = {};
+					bool collision           = false;
+
+					for (int j = 0; j < num_members && !collision; j++)
+					{
+						int slot       = (int)(Details::gStaticHashMix(key_hashes[members[j]], seed) & cSlotMask);
+						trial_slots[j] = slot;
+
+						collision = slot_used[slot];
+						for (int k = 0; k < j && !collision; k++)
+							collision = (trial_slots[k] == slot);
+					}
+
+					if (!collision)
+					{
+						for (int j = 0; j < num_members; j++)
+						{
+							slot_used[trial_slots[j]]    = true;
+							mSlotIndices[trial_slots[j]] = members[j];
+						}
+						mSeeds[bucket] = seed;
+						break;
+					}
+
+					seed++;
+					gAssert(seed < 1000000); // No perfect seed found; in constant evaluation this is a compile error.
+				}
+			}
+		}
+	}
+
+	constexpr int Size() const { return taSize; }
+
+	// Find a key. Returns a pointer to its value, or nullptr if the key isn't in the map.
+	constexpr const taValue* Find(const taKey& inKey) const
+	{
+		uint64 hash  = Details::gStaticHashKey(inKey);
+		uint32 seed  = mSeeds[hash & cSlotMask];
+		int    index = mSlotIndices[Details::gStaticHashMix(hash, seed) & cSlotMask];
+
+		// Present keys always land on their own slot (that's the construction guarantee); the
+		// checks only reject absent keys, which can land anywhere.
+		if (index >= 0 && mKeyValues[index].mKey == inKey)
+			return &mKeyValues[index].mValue;
+
+		return nullptr;
+	}
+
+	constexpr bool Contains(const taKey& inKey) const { return Find(inKey) != nullptr; }
+
+	// Iteration, in construction order.
+	constexpr const KeyValue<taKey, taValue>* Begin() const { return mKeyValues; }
+	constexpr const KeyValue<taKey, taValue>* End() const { return mKeyValues + taSize; }
+	constexpr const KeyValue<taKey, taValue>* begin() const { return Begin(); }
+	constexpr const KeyValue<taKey, taValue>* end() const { return End(); }
+
+private:
+	// Note: Not gGetNextPow2, it relies on intrinsics that aren't usable in constant evaluation.
+	static constexpr int cNumSlots = []() { int num = 1; while (num < taSize) num *= 2; return num; }();
+	static constexpr int cSlotMask = cNumSlots - 1;
+
+	KeyValue<taKey, taValue> mKeyValues[taSize]   = {}; // The key-values, in construction order.
+	uint32                   mSeeds[cNumSlots]    = {}; // Displacement seed of each bucket (0 = empty bucket).
+	int                      mSlotIndices[cNumSlots]; // Key-value index of each slot (-1 = empty slot).
+};
+
+template <typename taKey, typename taValue, int taSize>
+StaticHashMap(const KeyValue<taKey, taValue> (&)[taSize]) -> StaticHashMap<taKey, taValue, taSize>;
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/StaticSearchIndex.h>
+#include <Bedrock/Random.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("StaticSearchIndex")
+{
+	// Empty index.
+	StaticSearchIndex<uint64> index;
+	TEST_TRUE(index.Empty());
+	TEST_TRUE(index.LowerBound(42) == 0);
+	TEST_FALSE(index.Contains(42));
+
+	// Build from random sorted values (with duplicates) and compare every search against gLowerBound.
+	Vector<uint64> values;
+	uint32 seed = 42;
+	for (int i = 0; i < 1000; i++)
+	{
+		seed = gRand32(seed);
+		values.PushBack(seed % 500);
+	}
+	gSort(values);
+
+	index.Build(Span(values));
+	TEST_TRUE(index.Size() == values.Size());
+
+	for (uint64 searched = 0; searched < 510; searched++)
+	{
+		int expected = (int)(gLowerBound(values.Begin(), values.End(), searched) - values.Begin());
+		TEST_TRUE(index.LowerBound(searched) == expected);
+
+		bool expected_contains = expected != values.Size() && values[expected] == searched;
+		TEST_TRUE(index.Contains(searched) == expected_contains);
+	}
+
+	// Single value.
+	uint64 single[] = { 10 };
+	index.Build(Span(single));
+	TEST_TRUE(index.LowerBound(9) == 0);
+	TEST_TRUE(index.LowerBound(10) == 0);
+	TEST_TRUE(index.LowerBound(11) == 1);
+	TEST_TRUE(index.Contains(10));
+	TEST_FALSE(index.Contains(11));
+};
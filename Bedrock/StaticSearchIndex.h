@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/Vector.h>
+
+
+// Static search index over sorted data, for when the data is built once and searched millions of times.
+// Build copies the values in Eytzinger (BFS) order: the root in the middle of the sorted data comes
+// first, then its two children, then their four children, etc. All the elements visited during the
+// first levels of a search share a handful of cache lines (instead of one line per level with
+// gLowerBound), and the two possible next elements of each step are adjacent, so upcoming levels can
+// be prefetched. On sorted data much larger than the caches this searches 2-3x faster than a classic
+// binary search. The searches are also branchless (no mispredictions on random keys).
+// Searches return indices into the original sorted data, so companion arrays can be indexed with them.
+// Use VMemStaticSearchIndex (below) for very large indices.
+template <typename taType, template <typename> typename taAllocator = DefaultAllocator>
+struct StaticSearchIndex
+{
+	// Build the index from sorted values. The values are copied, the span doesn't need to stay alive.
+	void Build(Span<const taType> inSortedValues)
+	{
+		gAssert(gIsSorted(inSortedValues));
+
+		mNumValues = inSortedValues.Size();
+
+		// Slot 0 is unused, the root is at slot 1 (children of slot i are at 2*i and 2*i+1).
+		mValues.ClearAndFreeMemory();
+		mRanks.ClearAndFreeMemory();
+		mValues.Resize(mNumValues + 1, EResizeInit::NoZeroInit);
+		mRanks.Resize(mNumValues + 1, EResizeInit::NoZeroInit);
+
+		// An in-order walk of the implicit tree visits the sorted values in order.
+		int sorted_index = 0;
+		BuildRecursive(inSortedValues, sorted_index, 1);
+	}
+
+	int Size() const { return mNumValues; }
+	bool Empty() const { return mNumValues == 0; }
+
+	// Return the index (in the sorted values passed to Build) of the first value that is not less
+	// than inValue, or Size() if there is none. Equivalent to gLowerBound on the original data.
+	int LowerBound(const taType& inValue) const
+	{
+		uint32 slot = LowerBoundSlot(inValue);
+
+		if (slot == 0)
+			return mNumValues; // inValue is greater than every value.
+
+		return mRanks[(int)slot];
+	}
+
+	bool Contains(const taType& inValue) const
+	{
+		uint32 slot = LowerBoundSlot(inValue);
+
+		// The value at the lower bound slot is already known to be not less than inValue.
+		return slot != 0 && !(inValue < mValues[(int)slot]);
+	}
+
+private:
+	// Number of elements to jump ahead for prefetching (a few levels down the tree).
+	static constexpr int cPrefetchStride = gMax(64 / (int)sizeof(taType), 2);
+
+	// Return the slot of the first value that is not less than inValue, or 0 if there is none.
+	uint32 LowerBoundSlot(const taType& inValue) const
+	{
+		const taType* values = mValues.Data();
+		const uint32  num    = (uint32)mNumValues;
+
+		uint32 slot = 1;
+		while (slot <= num)
+		{
+			// Prefetch the great-grandchildren's cache line; by the time the search gets there it arrived.
+			// The min keeps the address inside the allocation, prefetching further is useless anyway.
+			gPrefetch(values + gMin((int64)slot * cPrefetchStride, (int64)num));
+
+			// Go left if inValue <= value, right otherwise. Compiles to a branchless cmp + adc.
+			slot = 2 * slot + (uint32)(values[slot] < inValue);
+		}
+
+		// Each right turn appended a 1 bit, each left turn a 0. The lower bound is where the last
+		// left turn happened, so cancel the right turns taken since then (the trailing 1 bits).
+		slot >>= gCountTrailingZeros32(~slot) + 1;
+
+		return slot;
+	}
+
+	void BuildRecursive(Span<const taType> inSortedValues, int& ioSortedIndex, int inSlot)
+	{
+		if (inSlot > mNumValues)
+			return;
+
+		BuildRecursive(inSortedValues, ioSortedIndex, 2 * inSlot);
+
+		mValues[inSlot] = inSortedValues[ioSortedIndex];
+		mRanks[inSlot]  = ioSortedIndex;
+		ioSortedIndex++;
+
+		BuildRecursive(inSortedValues, ioSortedIndex, 2 * inSlot + 1);
+	}
+
+	Vector<taType, taAllocator<taType>> mValues;    // The values in Eytzinger order (slot 0 unused).
+	Vector<int, taAllocator<int>>       mRanks;     // For each slot, the index of its value in the sorted order.
+	int                                 mNumValues = 0;
+};
+
+
+// Alias for a StaticSearchIndex using the VMemAllocator, for very large indices.
+template <typename taType>
+using VMemStaticSearchIndex = StaticSearchIndex<taType, VMemAllocator>;
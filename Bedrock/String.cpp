@@ -160,3 +160,53 @@ REGISTER_TEST("FixedString")
 	test.ShrinkToFit();
 	TEST_TRUE(test.Capacity() == test.Size() + 1);
 };
+
+
+REGISTER_TEST("InlineString")
+{
+	InlineString<16> test;
+
+	// Helper to check if the characters live in the embedded storage (ie. inside the string object itself).
+	auto is_inline = [](const auto& inString) {
+		return (const uint8*)inString.Data() >= (const uint8*)&inString
+			&& (const uint8*)inString.Data() <  (const uint8*)(&inString + 1);
+	};
+
+	// Short strings don't allocate.
+	test = "short";
+	TEST_TRUE(is_inline(test));
+	TEST_TRUE(test == "short");
+	TEST_TRUE(test.Size() == 5);
+
+	// 15 characters + null terminator still fit.
+	test = "123456789012345";
+	TEST_TRUE(is_inline(test));
+	TEST_TRUE(test.Size() == 15);
+
+	// One more character spills to the heap.
+	test.Append("6");
+	TEST_FALSE(is_inline(test));
+	TEST_TRUE(test == "1234567890123456");
+	TEST_TRUE(*test.End() == 0);
+
+	// Once spilled, moves steal the heap pointer as usual.
+	const char* heap_data = test.Data();
+	InlineString<16> moved = gMove(test);
+	TEST_FALSE(is_inline(moved));
+	TEST_TRUE(moved.Data() == heap_data);
+
+	// While inline, moves copy the characters instead (the storage can't be stolen).
+	InlineString<16> small = "small";
+	InlineString<16> moved_small = gMove(small);
+	TEST_TRUE(is_inline(moved_small));
+	TEST_TRUE(moved_small == "small");
+	TEST_TRUE(small.Empty());
+
+	// It's still a StringView, and converts to/from other string types.
+	StringView view = moved_small;
+	TEST_TRUE(view == "small");
+	String heap_string = moved_small;
+	TEST_TRUE(heap_string == "small");
+	InlineString<16> back_again = heap_string;
+	TEST_TRUE(is_inline(back_again));
+};
@@ -21,6 +21,12 @@ using TempString = StringBase<TempAllocator<char>>;
 template <int taCapacity>
 using FixedString = StringBase<FixedAllocator<char, taCapacity>>;
 
+// Alias for a String using an InlineAllocator (ie. small-string optimization).
+// Strings that fit in taCapacity (including the null terminator) are stored inline in the string
+// object itself (no allocation); longer ones spill to the heap.
+template <int taCapacity = 24>
+using InlineString = StringBase<InlineAllocator<char, taCapacity>>;
+
 
 template <typename taAllocator>
 struct StringBase : StringView, private taAllocator
@@ -91,6 +97,7 @@ struct StringBase : StringView, private taAllocator
 	int Capacity() const { return mCapacity; }
 
 	static constexpr bool cHasMaxSize = requires { taAllocator().MaxSize(); };
+	static constexpr bool cHasInlineStorage = requires(const taAllocator& inAllocator) { inAllocator.IsInlineData(nullptr); };
 
 	// Return the max size that this string can have.
 	// Note: This method only exists for allocators that have an actual max size.
@@ -117,6 +124,10 @@ static_assert(sizeof(StringBase<DefaultAllocator<char>>) == 16);
 // String is a contiguous container.
 template<typename T> inline constexpr bool cIsContiguous<StringBase<T>> = true;
 
+// Strings that don't store their characters inline can be relocated with a memcpy (the characters themselves don't move).
+// FixedString can't, its data pointer points inside the allocator.
+template<typename T> inline constexpr bool cIsTriviallyRelocatable<StringBase<T>> = !StringBase<T>::cHasInlineStorage;
+
 
 template <typename taAllocator>
 struct Hash<StringBase<taAllocator>> : Hash<StringView> {};
@@ -266,6 +277,18 @@ void StringBase<taAllocator>::MoveFrom(StringBase&& ioOther)
 		// Moving from self is not allowed.
 		gAssert(mData != ioOther.mData);
 
+		// If the other string's characters live in its allocator's embedded storage, the data
+		// pointer can't be stolen; copy the characters instead.
+		if constexpr (cHasInlineStorage)
+		{
+			if (ioOther.GetAllocator().IsInlineData(ioOther.mData))
+			{
+				CopyFrom(ioOther);
+				ioOther.Resize(0);
+				return;
+			}
+		}
+
 		// Free the existing data.
 		if (mData != cEmpty)
 			Allocator::Free(mData, mCapacity);
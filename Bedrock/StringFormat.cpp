@@ -79,4 +79,35 @@ REGISTER_TEST("StringFormat")
 		TempString("5").AsCStr(),
 		TempString("6").AsCStr());
 	TEST_TRUE(concat == "1 2 3 4 5 6");
+};
+
+
+REGISTER_TEST("StringFormat CompileTime")
+{
+	TEST_INIT_TEMP_MEMORY(1_KiB);
+
+	TempString test = gTempFormat<"hello {} {}">("world", 1);
+	TEST_TRUE(test == "hello world 1");
+
+	gAppendFormat<"{}">(test, "!!");
+	TEST_TRUE(test == "hello world 1!!");
+
+	String test2 = gFormat<"also with {} strings">("non-temp");
+	TEST_TRUE(test2 == "also with non-temp strings");
+
+	// No placeholders, adjacent placeholders, and placeholders at the edges.
+	TEST_TRUE(gFormat<"plain">() == "plain");
+	TEST_TRUE(gFormat<"{}{}">(1, 2) == "12");
+	TEST_TRUE(gFormat<"{} mid {}">("a", "b") == "a mid b");
+
+	// Every supported argument type.
+	TEST_TRUE(gFormat<"{}">(-123) == "-123");
+	TEST_TRUE(gFormat<"{}">(0) == "0");
+	TEST_TRUE(gFormat<"{}">(cMaxUInt64) == "18446744073709551615");
+	TEST_TRUE(gFormat<"{}">(-cMaxInt64 - 1) == "-9223372036854775808");
+	TEST_TRUE(gFormat<"{}">(true) == "true");
+	TEST_TRUE(gFormat<"{}">('x') == "x");
+	TEST_TRUE(gFormat<"{}">(1.5) == "1.5");
+	TEST_TRUE(gFormat<"{}">(StringView("view")) == "view");
+	TEST_TRUE(gFormat<"{}">(String("string")) == "string");
 };
\ No newline at end of file
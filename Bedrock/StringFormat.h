@@ -14,30 +14,6 @@ typedef char* va_list;
 #endif
 
 
-// Format a String and return it.
-// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
-#define gFormat(format, ...) \
-	((void)sizeof(printf(format, __VA_ARGS__)), Details::StringFormatRet<String>(format, __VA_ARGS__))
-
-
-// Format a TempString and return it.
-// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
-#define gTempFormat(format, ...) \
-	((void)sizeof(printf(format, __VA_ARGS__)), Details::StringFormatRet<TempString>(format, __VA_ARGS__))
-
-
-// Format and append into @a output.
-// Output can be any String-like class, it only needs an Append(const char*, int) method.
-// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
-#define gAppendFormat(output, format, ...)                  \
-	do                                                      \
-	{                                                       \
-		(void)sizeof(printf(format, __VA_ARGS__));          \
-		Details::StringFormat(output, format, __VA_ARGS__); \
-	} while (false)
-
-
-
 namespace Details
 {
 	// Callback passed to stbsp_vsprintfcb.
@@ -79,9 +55,186 @@ namespace Details
 		StringFormat(out_string, inFormat, gForward<taArgs>(ioArgs)...);
 		return out_string;
 	}
+
+
+	// Format string literal passed as a template parameter to the compile-time checked gFormat variants.
+	template <int taSize>
+	struct FormatString
+	{
+		consteval FormatString(const char (&inString)[taSize])
+		{
+			for (int i = 0; i < taSize; i++)
+				mData[i] = inString[i];
+		}
+
+		constexpr int Size() const { return taSize - 1; }
+
+		// Return the number of {} placeholders, or -1 if the format string is malformed.
+		constexpr int CountPlaceholders() const
+		{
+			int count = 0;
+			for (int i = 0; i < Size(); i++)
+			{
+				if (mData[i] == '{')
+				{
+					if (i + 1 >= Size() || mData[i + 1] != '}')
+						return -1; // '{' not followed by '}'.
+					count++;
+					i++;
+				}
+				else if (mData[i] == '}')
+				{
+					return -1; // '}' without a '{'.
+				}
+			}
+			return count;
+		}
+
+		char mData[taSize] = {};
+	};
+
+
+	// Append a single formatted argument in place of a {} placeholder.
+	template <class taString, typename taArg>
+	void AppendFormatArg(taString& outString, const taArg& inArg)
+	{
+		if constexpr (cIsSame<taArg, bool>)
+		{
+			StringView value = inArg ? StringView("true") : StringView("false");
+			outString.Append(value.Data(), value.Size());
+		}
+		else if constexpr (cIsSame<taArg, char>)
+		{
+			outString.Append(&inArg, 1);
+		}
+		else if constexpr (cIsIntegral<taArg>)
+		{
+			// Write the digits backwards into a small buffer.
+			char   buffer[20]; // Enough for the largest uint64.
+			char*  ptr      = buffer + sizeof(buffer);
+			bool   negative = false;
+			uint64 value;
+
+			if constexpr (taArg(-1) < taArg(0))
+			{
+				negative = inArg < 0;
+				value    = negative ? (uint64)0 - (uint64)inArg : (uint64)inArg;
+			}
+			else
+			{
+				value = (uint64)inArg;
+			}
+
+			do
+			{
+				*--ptr = (char)('0' + value % 10);
+				value /= 10;
+			} while (value != 0);
+
+			if (negative)
+				outString.Append("-", 1);
+			outString.Append(ptr, (int)(buffer + sizeof(buffer) - ptr));
+		}
+		else if constexpr (cIsAnyOf<taArg, float, double>)
+		{
+			// Floats go through the printf engine; formatting them correctly by hand is not worth it.
+			StringFormat(outString, "%g", (double)inArg);
+		}
+		else if constexpr (cIsConvertible<const taArg&, StringView>)
+		{
+			StringView value = inArg;
+			outString.Append(value.Data(), value.Size());
+		}
+		else
+		{
+			static_assert(cIsSame<taArg, void>, "Unsupported argument type for the compile-time checked gFormat");
+		}
+	}
+
+
+	// Internal function doing the actual formatting for the compile-time checked gFormat variants.
+	// The format string is validated at compile time, then expanded in a single pass with no measuring
+	// step and no va_list.
+	template <FormatString taFormat, class taString, typename... taArgs>
+	void StringFormatCT(taString& outString, const taArgs&... inArgs)
+	{
+		constexpr int cNumPlaceholders = taFormat.CountPlaceholders();
+		static_assert(cNumPlaceholders != -1, "Malformed format string: braces may only appear as {} placeholders");
+		static_assert(cNumPlaceholders == sizeof...(taArgs), "Number of arguments does not match the number of {} placeholders");
+
+		StringView remaining(taFormat.mData, taFormat.Size());
+
+		auto append_next = [&outString, &remaining](const auto& inArg)
+		{
+			// Copy the literal part up to the next placeholder.
+			int placeholder_pos = remaining.Find(StringView("{}"));
+			outString.Append(remaining.Data(), placeholder_pos);
+			remaining.RemovePrefix(placeholder_pos + 2);
+
+			AppendFormatArg(outString, inArg);
+		};
+		(append_next(inArgs), ...);
+
+		// Copy the literal part after the last placeholder.
+		outString.Append(remaining.Data(), remaining.Size());
+	}
+}
+
+
+// Format a String and return it. Compile-time checked variant: the format string is parsed at compile
+// time and arguments are formatted where the {} placeholders are, in a single pass, with no printf.
+// eg. gFormat<"hello {} {}">("world", 1)
+template <Details::FormatString taFormat, typename... taArgs>
+String gFormat(const taArgs&... inArgs)
+{
+	String out_string;
+	Details::StringFormatCT<taFormat>(out_string, inArgs...);
+	return out_string;
+}
+
+
+// Format a TempString and return it. Compile-time checked variant, see gFormat above.
+template <Details::FormatString taFormat, typename... taArgs>
+TempString gTempFormat(const taArgs&... inArgs)
+{
+	TempString out_string;
+	Details::StringFormatCT<taFormat>(out_string, inArgs...);
+	return out_string;
 }
 
 
+// Format and append into ioString. Compile-time checked variant, see gFormat above.
+// ioString can be any String-like class, it only needs an Append(const char*, int) method.
+template <Details::FormatString taFormat, class taString, typename... taArgs>
+void gAppendFormat(taString& ioString, const taArgs&... inArgs)
+{
+	Details::StringFormatCT<taFormat>(ioString, inArgs...);
+}
+
+
+// Format a String and return it.
+// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
+#define gFormat(format, ...) \
+	((void)sizeof(printf(format, __VA_ARGS__)), Details::StringFormatRet<String>(format, __VA_ARGS__))
+
+
+// Format a TempString and return it.
+// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
+#define gTempFormat(format, ...) \
+	((void)sizeof(printf(format, __VA_ARGS__)), Details::StringFormatRet<TempString>(format, __VA_ARGS__))
+
+
+// Format and append into @a output.
+// Output can be any String-like class, it only needs an Append(const char*, int) method.
+// Note: The fake call to printf is there to catch format errors. Unlike attribute format, this also works with MSVC.
+#define gAppendFormat(output, format, ...)                  \
+	do                                                      \
+	{                                                       \
+		(void)sizeof(printf(format, __VA_ARGS__));          \
+		Details::StringFormat(output, format, __VA_ARGS__); \
+	} while (false)
+
+
 // Variant of gFormat that takes a va_list.
 inline String gFormatV(const char* inFormat, va_list inArgs)
 {
@@ -110,7 +263,3 @@ void gAppendFormatV(taString& outString, const char* inFormat, va_list inArgs)
 
 // Printf forward declaration for the format validation hack above.
 extern "C" int __cdecl printf(const char* inFormat, ...);
-
-
-
-
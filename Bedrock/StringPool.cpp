@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/StringPool.h>
+
+#include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+
+
+REGISTER_TEST("StringPool")
+{
+	StringPool pool;
+	TEST_TRUE(pool.GetNumStrings() == 0);
+
+	// Interning the same characters returns the same id, even from different buffers.
+	InternedString hello = pool.Intern("hello");
+	InternedString world = pool.Intern("world");
+	TEST_TRUE(hello.IsValid());
+	TEST_TRUE(hello != world);
+
+	String hello_copy = "hello";
+	TEST_TRUE(pool.Intern(hello_copy) == hello);
+	TEST_TRUE(pool.GetNumStrings() == 2);
+
+	// The characters come back identical and null-terminated.
+	StringView recovered = pool.Get(hello);
+	TEST_TRUE(recovered == "hello");
+	TEST_TRUE(recovered.Data()[recovered.Size()] == 0);
+
+	// The empty string interns fine too.
+	InternedString empty = pool.Intern("");
+	TEST_TRUE(empty.IsValid());
+	TEST_TRUE(pool.Get(empty) == "");
+
+	// A default-constructed id is invalid and equal to no interned string.
+	InternedString invalid;
+	TEST_FALSE(invalid.IsValid());
+	TEST_TRUE(invalid != hello);
+
+	// Many strings; the views stay valid as the pool grows.
+	Vector<InternedString> ids;
+	for (int i = 0; i < 1000; i++)
+		ids.PushBack(pool.Intern(gFormat("path/to/some/asset_%d.dds", i)));
+
+	for (int i = 0; i < 1000; i++)
+	{
+		TEST_TRUE(pool.Get(ids[i]) == gFormat("path/to/some/asset_%d.dds", i));
+		TEST_TRUE(pool.Intern(pool.Get(ids[i])) == ids[i]); // Re-interning is a no-op.
+	}
+	TEST_TRUE(pool.GetNumStrings() == 1003);
+	TEST_TRUE(recovered == "hello"); // The early views didn't move.
+
+	// Interned ids work as HashMap keys.
+	HashMap<InternedString, int> map;
+	map.Insert(hello, 1);
+	map.Insert(world, 2);
+	TEST_TRUE(map.Find(pool.Intern("hello"))->mValue == 1);
+	TEST_TRUE(map.Find(pool.Intern("world"))->mValue == 2);
+};
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/HashMap.h>
+#include <Bedrock/MemoryArena.h>
+#include <Bedrock/StringView.h>
+#include <Bedrock/Vector.h>
+
+
+struct StringPool;
+
+
+// 32-bit id of a string interned in a StringPool.
+// Two ids from the same pool are equal if and only if the strings are equal, so comparing (or
+// hashing) one is a single integer op. Use it to replace String keys in large HashMaps.
+struct InternedString
+{
+	InternedString() = default;
+
+	bool   IsValid() const { return mID != cInvalidID; }
+	uint32 GetID() const { return mID; }
+
+	bool operator==(const InternedString&) const = default;
+
+private:
+	friend struct StringPool;
+	friend struct Hash<InternedString>;
+
+	explicit InternedString(uint32 inID) : mID(inID) {}
+
+	static constexpr uint32 cInvalidID = 0xFFFFFFFF;
+
+	uint32 mID = cInvalidID;
+};
+
+
+template <>
+struct Hash<InternedString>
+{
+	uint64 operator()(InternedString inString) const { return gHash(inString.mID); }
+};
+
+
+// Deduplicating string storage.
+// Interning copies a string into arena-backed storage once and hands back a 32-bit id; interning
+// the same characters again returns the same id. The characters are stored contiguously (and
+// null-terminated) in a VMemArena, so they never move and the StringViews handed back stay valid
+// for the lifetime of the pool. Strings are never freed individually.
+struct StringPool : NoCopy
+{
+	StringPool() = default;
+	~StringPool() { mArena.Rewind(0); } // The interned strings are freed all at once.
+
+	// Intern a string, returning its id. O(1), one hash lookup when the string is already interned.
+	InternedString Intern(StringView inString)
+	{
+		if (auto iter = mLookup.Find(inString); iter != mLookup.End())
+			return InternedString(iter->mValue);
+
+		// Copy the characters into the arena, with a null terminator for C API convenience.
+		int      size    = inString.Size();
+		MemBlock storage = mArena.Alloc(size + 1);
+		gMemCopy(storage.mPtr, inString.Data(), size);
+		storage.mPtr[size] = 0;
+
+		StringView pooled_string((const char*)storage.mPtr, size);
+		uint32     id = (uint32)mStrings.Size();
+
+		mStrings.PushBack(pooled_string);
+		mLookup.Insert(pooled_string, id);
+
+		return InternedString(id);
+	}
+
+	// Get the characters of an interned string back.
+	StringView Get(InternedString inString) const
+	{
+		gAssert(inString.IsValid());
+		return mStrings[(int)inString.mID];
+	}
+
+	// Number of unique strings interned so far.
+	int GetNumStrings() const { return mStrings.Size(); }
+
+private:
+	VMemArena<0>                      mArena;    // Characters of the interned strings. Grows, never moves.
+	Vector<StringView>                mStrings;  // Id to characters, in interning order.
+	CachedHashMap<StringView, uint32> mLookup;   // Characters to id. The keys point into the arena;
+	                                             // caching the hashes keeps rehashes from re-reading them all.
+};
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MPL-2.0
 #include<Bedrock/StringView.h>
 #include<Bedrock/Hash.h>
+#include<Bedrock/String.h>
 #include<Bedrock/Test.h>
 
 
@@ -82,3 +83,56 @@ REGISTER_TEST("StringView")
 	}
 };
 
+
+REGISTER_TEST("StringView Find Large")
+{
+	// The vectorized Find paths only kick in on haystacks larger than one SIMD block,
+	// so exercise them with a few hundred characters.
+	String haystack;
+	for (int i = 0; i < 20; i++)
+		haystack.Append("abcdefghijklmnop");
+	StringView view = haystack;
+
+	TEST_TRUE(view.Find('q') == -1);
+	TEST_TRUE(view.Find("zzy") == -1);
+	TEST_TRUE(view.FindFirstOf("qrz") == -1);
+
+	// Place the searched characters at every position to cover all block alignments and the tail.
+	for (int i = 0; i + 3 <= view.Size(); i++)
+	{
+		char saved[3] = { haystack[i], haystack[i + 1], haystack[i + 2] };
+		haystack[i]     = 'z';
+		haystack[i + 1] = 'z';
+		haystack[i + 2] = 'y';
+
+		TEST_TRUE(view.Find('z') == i);
+		TEST_TRUE(view.Find("zzy") == i);
+		TEST_TRUE(view.FindFirstOf("yz") == i);
+
+		haystack[i]     = saved[0];
+		haystack[i + 1] = saved[1];
+		haystack[i + 2] = saved[2];
+	}
+
+	// Repetitive data causes lots of anchor matches that the full comparison must reject.
+	String repetitive;
+	for (int i = 0; i < 100; i++)
+		repetitive.Append("a");
+	repetitive.Append("b");
+	StringView repetitive_view = repetitive;
+
+	TEST_TRUE(repetitive_view.Find("ab") == 99);
+	TEST_TRUE(repetitive_view.Find("aab") == 98);
+	TEST_TRUE(repetitive_view.Find("ba") == -1);
+
+	// Characters above 127 must not be mistaken for negative indices.
+	StringView high_bit = "caf\xC3\xA9 latte";
+	TEST_TRUE(high_bit.Find('\xC3') == 3);
+	TEST_TRUE(high_bit.FindFirstOf("\xA9\xC3") == 3);
+
+	// The scalar paths are still used at compile time.
+	static_assert(StringView("hello world").Find('w') == 6);
+	static_assert(StringView("hello world").Find("world") == 6);
+	static_assert(StringView("hello world").FindFirstOf("dw") == 6);
+};
+
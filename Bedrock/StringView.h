@@ -4,6 +4,120 @@
 #include <Bedrock/Core.h>
 #include <Bedrock/Algorithm.h>
 
+// SSE2 is always available on x64, use it for searching. Other targets get a scalar fallback.
+#if defined(_M_X64) || defined(__SSE2__)
+#define BEDROCK_STRING_SSE2 1
+#include <emmintrin.h>
+#else
+#define BEDROCK_STRING_SSE2 0
+#endif
+
+
+namespace Details
+{
+	// Return a pointer to the first occurrence of inCharacter in [inBegin, inEnd), or inEnd if not found.
+	// Compares 16 characters per iteration (memchr-style).
+	inline const char* gFindCharFast(const char* inBegin, const char* inEnd, char inCharacter)
+	{
+		const char* ptr = inBegin;
+
+#if BEDROCK_STRING_SSE2
+		__m128i searched = _mm_set1_epi8(inCharacter);
+
+		while (inEnd - ptr >= 16)
+		{
+			__m128i block      = _mm_loadu_si128((const __m128i*)ptr);
+			uint32  match_mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, searched));
+
+			if (match_mask != 0)
+				return ptr + gCountTrailingZeros32(match_mask);
+
+			ptr += 16;
+		}
+#endif
+
+		// Scalar loop for the last few characters (or everything on non-SSE2 targets).
+		for (; ptr != inEnd; ptr++)
+			if (*ptr == inCharacter)
+				return ptr;
+
+		return inEnd;
+	}
+
+	// Return a pointer to the first occurrence of inString in [inBegin, inEnd), or inEnd if not found.
+	// Matches the first and last character of inString 16 positions at a time, and only runs the full
+	// comparison where both match. The two anchors make false positives rare even in repetitive data.
+	inline const char* gFindStringFast(const char* inBegin, const char* inEnd, const char* inString, int inStringSize)
+	{
+		gAssert(inStringSize > 0);
+
+		if (inEnd - inBegin < inStringSize)
+			return inEnd;
+
+		if (inStringSize == 1)
+			return gFindCharFast(inBegin, inEnd, inString[0]);
+
+		const char* ptr        = inBegin;
+		const char* last_start = inEnd - inStringSize; // Last position where inString can start.
+
+#if BEDROCK_STRING_SSE2
+		__m128i first = _mm_set1_epi8(inString[0]);
+		__m128i last  = _mm_set1_epi8(inString[inStringSize - 1]);
+
+		// Loads are 16 characters at ptr and at (ptr + inStringSize - 1); stop before they pass inEnd.
+		while (last_start - ptr >= 15)
+		{
+			__m128i block_first = _mm_loadu_si128((const __m128i*)ptr);
+			__m128i block_last  = _mm_loadu_si128((const __m128i*)(ptr + inStringSize - 1));
+			uint32  match_mask  = (uint32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+
+			while (match_mask != 0)
+			{
+				int offset = gCountTrailingZeros32(match_mask);
+
+				// Both anchors matched, compare the characters in between.
+				if (gMemCmp(ptr + offset + 1, inString + 1, inStringSize - 2) == 0)
+					return ptr + offset;
+
+				match_mask &= match_mask - 1; // Clear the lowest set bit.
+			}
+
+			ptr += 16;
+		}
+#endif
+
+		// Scalar loop for the last few start positions (or everything on non-SSE2 targets).
+		for (; ptr <= last_start; ptr++)
+			if (*ptr == inString[0] && gMemCmp(ptr + 1, inString + 1, inStringSize - 1) == 0)
+				return ptr;
+
+		return inEnd;
+	}
+
+	// Return a pointer to the first character of [inBegin, inEnd) present in inCharacters, or inEnd if not found.
+	// Builds a 256-bit bitmap of the searched characters so each haystack character is a single test,
+	// instead of a loop over inCharacters.
+	inline const char* gFindFirstOfFast(const char* inBegin, const char* inEnd, const char* inCharacters, int inCharactersSize)
+	{
+		uint64 bitmap[4] = {};
+		for (int i = 0; i < inCharactersSize; i++)
+		{
+			uint8 c = (uint8)inCharacters[i];
+			bitmap[c >> 6] |= (uint64)1 << (c & 63);
+		}
+
+		for (const char* ptr = inBegin; ptr != inEnd; ptr++)
+		{
+			uint8 c = (uint8)*ptr;
+			if (bitmap[c >> 6] & ((uint64)1 << (c & 63)))
+				return ptr;
+		}
+
+		return inEnd;
+	}
+}
+
+
 struct StringView
 {
 	constexpr StringView()								= default;
@@ -115,7 +229,12 @@ constexpr bool StringView::operator<(StringView inOther) const
 
 constexpr int StringView::Find(char inCharacter, int inPosition) const
 {
-	const char* iter = gFind(Begin() + inPosition, End(), inCharacter);
+	const char* iter;
+	if (__builtin_is_constant_evaluated())
+		iter = gFind(Begin() + inPosition, End(), inCharacter);
+	else
+		iter = Details::gFindCharFast(Begin() + inPosition, End(), inCharacter);
+
 	if (iter == End())
 		return -1;
 	else
@@ -128,6 +247,15 @@ constexpr int StringView::Find(StringView inString, int inPosition) const
 	if (inString.Empty())
 		return -1;
 
+	if (!__builtin_is_constant_evaluated())
+	{
+		const char* iter = Details::gFindStringFast(Begin() + inPosition, End(), inString.Data(), inString.Size());
+		if (iter == End())
+			return -1;
+		else
+			return (int)(iter - Begin());
+	}
+
 	const char searched_first_char = inString[0];
 	const int searched_size = inString.Size();
 
@@ -153,6 +281,15 @@ constexpr int StringView::Find(StringView inString, int inPosition) const
 
 constexpr int StringView::FindFirstOf(StringView inCharacters) const
 {
+	if (!__builtin_is_constant_evaluated())
+	{
+		const char* iter = Details::gFindFirstOfFast(Begin(), End(), inCharacters.Data(), inCharacters.Size());
+		if (iter == End())
+			return -1;
+		else
+			return (int)(iter - Begin());
+	}
+
 	for (const char& c : *this)
 	{
 		if (gContains(inCharacters, c))
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/SwissHashMap.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/String.h>
+#include <Bedrock/Random.h>
+
+
+REGISTER_TEST("SwissHashMap")
+{
+	SwissHashMap<String, String> map;
+	TEST_TRUE(map.Insert("bread", "butter").mResult == EInsertResult::Added);
+	TEST_TRUE(map.Insert("bread", "jam").mResult == EInsertResult::Found);
+	map["toast"] = "rubbish";
+	String cheese("cheese");
+	TEST_TRUE(map.Insert(StringView("baguette"), cheese).mResult == EInsertResult::Added);
+	TEST_TRUE(map.Emplace("bun", "no").mResult == EInsertResult::Added);
+	String brioche("brioche");
+	TEST_TRUE(map.Emplace(brioche, "jam").mResult == EInsertResult::Added);
+	TEST_TRUE(map.InsertOrAssign(brioche, "peanut butter").mResult == EInsertResult::Replaced);
+	TEST_TRUE(map.InsertOrAssign("croissant", "chocolate").mResult == EInsertResult::Added);
+
+	TEST_TRUE(map.Find("bread")->mValue == "butter");
+	TEST_TRUE(map.Find("toast")->mValue == "rubbish");
+	TEST_TRUE(map.Find(StringView("baguette"))->mValue == "cheese");
+	TEST_TRUE(map["bun"] == "no");
+	map["bun"] = "burger";
+	TEST_TRUE(map.Find("bun")->mValue == "burger");
+	TEST_TRUE(map.Find("brioche")->mValue == "peanut butter");
+	TEST_TRUE(map.Find("croissant")->mValue == "chocolate");
+
+	TEST_TRUE(map.Insert("ciabatta", "is baguette").mResult == EInsertResult::Added);
+	TEST_TRUE(map.Insert("pain", "perdu").mResult == EInsertResult::Added);
+	TEST_TRUE(map.Find("broad") == map.End());
+
+	TEST_TRUE(map.Erase("ciabatta"));
+	TEST_TRUE(map.Find("ciabatta") == map.End());
+	TEST_TRUE(map.Find("pain")->mValue == "perdu");
+	TEST_FALSE(map.Erase("broad"));
+
+	TEST_TRUE(map.Erase("bread"));
+	TEST_TRUE(map.Erase("toast"));
+	TEST_TRUE(map.Erase("brioche"));
+	TEST_TRUE(map.Erase("croissant"));
+};
+
+
+REGISTER_TEST("SwissHashSet")
+{
+	SwissHashSet<String> set;
+
+	TEST_TRUE(set.Insert("bread").mResult == EInsertResult::Added);
+	TEST_TRUE(set.Insert("bread").mResult == EInsertResult::Found);
+	TEST_TRUE(set.Insert(StringView("baguette")).mResult == EInsertResult::Added);
+	TEST_TRUE(set.Emplace("pretzel").mResult == EInsertResult::Added);
+
+	TEST_TRUE(set.Contains("bread"));
+	TEST_TRUE(set.Contains(StringView("baguette")));
+	TEST_TRUE(set.Contains("pretzel"));
+	TEST_TRUE(set.Find("broad") == set.End());
+
+	TEST_TRUE(set.Erase("pretzel"));
+	TEST_FALSE(set.Contains("pretzel"));
+	TEST_TRUE(set.Erase("bread"));
+	TEST_TRUE(set.Erase("baguette"));
+};
+
+
+template <class taHashMap>
+static void sLargeSwissHashMapTest(taHashMap& map)
+{
+	constexpr int cSize            = 100000;
+	constexpr int cInitialRandSeed = 42;
+
+	// Fill a map with lots of random values.
+	int rand_seed = cInitialRandSeed;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		map.Insert(i, rand_seed);
+	}
+
+	// Check that all the values are found.
+	rand_seed = cInitialRandSeed;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		auto iter = map.Find(i);
+		TEST_TRUE(iter != map.End());
+		TEST_TRUE(iter->mKey == i);
+		TEST_TRUE(iter->mValue == rand_seed);
+	}
+
+	// Make a copy
+	decltype(map) map2 = map;
+
+	// Check that all the values are found in copy.
+	rand_seed = cInitialRandSeed;
+	for (int i = 0; i < cSize; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		auto iter = map2.Find(i);
+		TEST_TRUE(iter != map2.End());
+		TEST_TRUE(iter->mKey == i);
+		TEST_TRUE(iter->mValue == rand_seed);
+	}
+
+	// Remove all the values.
+	for (int i = 0; i < cSize; i++)
+	{
+		TEST_TRUE(map.Erase(i));
+	}
+}
+
+
+REGISTER_TEST("Large SwissHashMap")
+{
+	SwissHashMap<int, int> map;
+	sLargeSwissHashMapTest(map);
+};
+
+
+REGISTER_TEST("Large Temp SwissHashMap")
+{
+	TEST_INIT_TEMP_MEMORY(100_KiB);
+
+	TempSwissHashMap<int, int> map;
+	sLargeSwissHashMapTest(map);
+};
+
+
+REGISTER_TEST("SwissHashMap Tombstones")
+{
+	// Erase/insert repeatedly at a stable size to make sure tombstones get cleaned up and the map doesn't degenerate.
+	SwissHashMap<int, int> map;
+
+	constexpr int cSize = 1000;
+	for (int i = 0; i < cSize; i++)
+		map.Insert(i, i);
+
+	for (int cycle = 0; cycle < 50; cycle++)
+	{
+		// Erase half the keys.
+		for (int i = 0; i < cSize; i += 2)
+			TEST_TRUE(map.Erase(i));
+
+		// Re-insert them.
+		for (int i = 0; i < cSize; i += 2)
+			TEST_TRUE(map.Insert(i, i).mResult == EInsertResult::Added);
+	}
+
+	TEST_TRUE(map.Size() == cSize);
+	for (int i = 0; i < cSize; i++)
+		TEST_TRUE(map.Find(i)->mValue == i);
+
+	for (int i = 0; i < cSize; i++)
+		TEST_TRUE(map.Erase(i));
+	TEST_TRUE(map.Empty());
+};
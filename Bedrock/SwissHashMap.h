@@ -0,0 +1,636 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Hash.h>
+#include <Bedrock/Vector.h>
+#include <Bedrock/HashMap.h> // For KeyValue, MapInsertResult/SetInsertResult and EInsertResult.
+
+// SSE2 is always available on x64, use it for probing. Other targets get a scalar fallback.
+#if defined(_M_X64) || defined(__SSE2__)
+#define BEDROCK_SWISS_SSE2 1
+#include <emmintrin.h>
+#else
+#define BEDROCK_SWISS_SSE2 0
+#endif
+
+
+namespace Details
+{
+	// Metadata byte values for SwissHashMap slots. Used slots store (cSwissUsedBit | fingerprint).
+	constexpr uint8 cSwissEmpty   = 0x00;
+	constexpr uint8 cSwissDeleted = 0x01;
+	constexpr uint8 cSwissUsedBit = 0x80;
+
+	constexpr int cSwissGroupSize = 16; // Metadata bytes probed in a single compare.
+
+	// Compare the 16 metadata bytes of a group against inByte. Return one bit per matching byte.
+	inline uint32 gSwissMatchByte(const uint8* inGroup, uint8 inByte)
+	{
+#if BEDROCK_SWISS_SSE2
+		__m128i group = _mm_loadu_si128((const __m128i*)inGroup);
+		__m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)inByte));
+		return (uint32)_mm_movemask_epi8(match);
+#else
+		uint32 match_mask = 0;
+		for (int i = 0; i < cSwissGroupSize; i++)
+			if (inGroup[i] == inByte)
+				match_mask |= 1u << i;
+		return match_mask;
+#endif
+	}
+}
+
+
+// Swiss-table-style HashMap.
+// Fingerprints are packed into 16-byte metadata groups and probed with a single SSE2 compare,
+// so a probe sequence usually resolves in one or two vector ops instead of one load per bucket.
+// Like HashMap, the key-values are stored contiguously (no holes), so iteration is very fast.
+// Unlike HashMap (Robin Hood), erased slots leave tombstones; they are cleaned up on the next rehash.
+// Supports TempAllocator. Behaves as a set if taValue is void (see SwissHashSet typedef below).
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+struct SwissHashMap : taHash
+{
+	static constexpr bool cIsMap = !cIsVoid<taValue>;
+	static constexpr bool cIsSet =  cIsVoid<taValue>;
+
+	using KeyValue = Conditional<cIsMap, KeyValue<taKey, taValue>, taKey>;
+	using InsertResult = Conditional<cIsMap, MapInsertResult<taKey, taValue>, SetInsertResult<taKey>>;
+
+	using ConstIter = const KeyValue*;
+	using Iter = const KeyValue*; // FIXME Iter should not allow modifying keys
+
+	// Default
+	SwissHashMap() = default;
+	~SwissHashMap() = default;
+
+	// Move
+	SwissHashMap(SwissHashMap&&) = default;
+	SwissHashMap& operator=(SwissHashMap&& ioOther) = default;
+
+	// Copy
+	SwissHashMap(const SwissHashMap& inOther);
+	SwissHashMap& operator=(const SwissHashMap& inOther);
+
+	void Clear();
+	bool Empty() const { return mKeyValues.Empty(); }
+	bool IsFull() const	{ return mKeyValues.Size() == mKeyValues.Capacity(); }
+
+	int Size() const { return mKeyValues.Size(); }
+	int Capacity() const { return mKeyValues.Capacity(); }
+
+	ConstIter Begin() const { return mKeyValues.Begin(); }
+	ConstIter End() const { return mKeyValues.End(); }
+	Iter Begin() { return mKeyValues.Begin(); }
+	Iter End() { return mKeyValues.End(); }
+	ConstIter begin() const { return mKeyValues.Begin(); }
+	ConstIter end() const { return mKeyValues.End(); }
+	Iter begin() { return mKeyValues.Begin(); }
+	Iter end() { return mKeyValues.End(); }
+
+	// Find (non-const) ---------------------------------------
+
+	Iter Find(const taKey& inKey) requires cIsMap
+	{
+		return FindInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	Iter Find(const taAltKey& inKey) requires cIsMap
+	{
+		return FindInternal(inKey);
+	}
+
+	// Find (const) -------------------------------------------
+
+	ConstIter Find(const taKey& inKey) const
+	{
+		return FindInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	ConstIter Find(const taAltKey& inKey) const
+	{
+		return FindInternal(inKey);
+	}
+
+	// Contains -----------------------------------------------
+
+	bool Contains(const taKey& inKey) const
+	{
+		return FindInternal(inKey) != End();
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Contains(const taAltKey& inKey) const
+	{
+		return FindInternal(inKey) != End();
+	}
+
+	// Insert (Map version) -----------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(const taKey& inKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(taKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltKey, typename taAltValue>
+	requires cIsTransparent<taHash> && cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(taAltKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gForward<taAltKey>(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Insert (Set version) -----------------------------------
+
+	InsertResult Insert(const taKey& inKey) requires cIsSet
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey);
+	}
+
+	InsertResult Insert(taKey&& ioKey) requires cIsSet
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey));
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	InsertResult Insert(taAltKey&& ioKey) requires cIsSet
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gForward<taAltKey>(ioKey));
+	}
+
+	// InsertOrAssign (Map only) ------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(const taKey& inKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(taKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltKey, typename taAltValue>
+	requires cIsTransparent<taHash> && cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(taAltKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(gForward<taAltKey>(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Emplace (Map and Set) ---------------------------------
+
+	template <typename... taArgs>
+	InsertResult Emplace(const taKey& inKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taArgs>(ioArgs)...);
+	}
+
+	template <typename... taArgs>
+	InsertResult Emplace(taKey&& ioKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taArgs>(ioArgs)...);
+	}
+
+	template <typename taAltKey, typename... taArgs>
+	requires cIsTransparent<taHash>
+	InsertResult Emplace(taAltKey&& ioKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gForward<taAltKey>(ioKey), gForward<taArgs>(ioArgs)...);
+	}
+
+	// Operator[] (Map only) ---------------------------------
+
+	template<class T = taValue>
+	T& operator[](const taKey& inKey) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey).mValue;
+	}
+
+	template<class T = taValue>
+	T& operator[](taKey&& ioKey)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey)).mValue;
+	}
+
+	template <typename taAltKey, class T = taValue>
+	requires cIsTransparent<taHash>
+	T& operator[](taAltKey&& ioKey) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gForward<taAltKey>(ioKey)).mValue;
+	}
+
+	// Erase (Map and Set) -----------------------------------
+
+	bool Erase(const taKey& inKey)
+	{
+		return EraseInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	requires cIsTransparent<taHash>
+	bool Erase(const taAltKey& inKey)
+	{
+		return EraseInternal(inKey);
+	}
+
+	Iter Erase(Iter inIter)
+	{
+		EraseInternal(GetKey(*inIter));
+		return inIter;
+	}
+
+	// Reserve (Map and Set) -----------------------------------
+
+	void Reserve(int inCapacity)
+	{
+		if (inCapacity <= Capacity())
+			return;
+
+		// Capacity is in number of KeyValues.
+		// Number of slots has to be a power of 2 (and a multiple of the group size).
+		int new_num_slots = (int)gGetNextPow2(inCapacity);
+
+		// Also we can only use ~80% of the slots, so double the number again if that wouldn't fit.
+		int num_key_values = new_num_slots * 13 / 16; // 13/16 = 0.8125
+		if (num_key_values < inCapacity)
+			new_num_slots *= 2;
+
+		Grow(new_num_slots);
+	}
+
+protected:
+	static constexpr int cGroupSize = Details::cSwissGroupSize;
+
+	// Build the fingerprint stored in the metadata for this hash (low 7 bits + used marker).
+	static uint8 sGetFingerprint(uint64 inHash)
+	{
+		return (uint8)(Details::cSwissUsedBit | (inHash & 0x7F));
+	}
+
+	// Get the mask to use when incrementing group indices to get wrap-around.
+	// The number of groups is a power of 2, so we can use a bitwise and as a faster modulo.
+	int GetGroupMask() const
+	{
+		gAssert(!mMetadata.Empty());
+		return (mMetadata.Size() / cGroupSize) - 1;
+	}
+
+	// Number of slots that are not empty (used + tombstones). Once this hits the max load, a rehash is needed.
+	int GetNumUsedSlots() const
+	{
+		return mKeyValues.Size() + mNumTombstones;
+	}
+
+	// Helper to get the key (because of the KeyValue difference between Map/Set).
+	const taKey& GetKey(const KeyValue& ioKeyValue) const
+	{
+		if constexpr (cIsMap)
+			return ioKeyValue.mKey;
+		else
+			return ioKeyValue;
+	}
+
+	// Increase the capacity of the map (or rehash at the same size to get rid of tombstones).
+	void Grow(int inNumSlots)
+	{
+		gAssert(inNumSlots == 0 || gIsPow2(inNumSlots));
+		gAssert(inNumSlots == 0 || inNumSlots >= mMetadata.Size());
+
+		int new_num_slots = gMax(inNumSlots, cGroupSize);
+		int new_key_values_size = new_num_slots * 13 / 16; // 13/16 = 0.8125
+
+		// Free the metadata first to make sure the TempAllocator can grow the key-values allocation.
+		mMetadata.ClearAndFreeMemory();
+		mSlots.ClearAndFreeMemory();
+		mKeyValues.Reserve(new_key_values_size);
+
+		// Re-allocate the metadata (zero-initialized, so all slots start empty) and the slot indices.
+		mMetadata.Resize(new_num_slots);
+		mSlots.Resize(new_num_slots, EResizeInit::NoZeroInit);
+		mNumTombstones = 0;
+
+		// Fill the slots.
+		for (const KeyValue& key_value : mKeyValues)
+		{
+			// Find the right slot for this key.
+			// Note: We know the key is not already present so we can skip the key compares.
+			bool key_may_be_found = false;
+			auto [slot_index, fingerprint, _] = FindSlot(GetKey(key_value), key_may_be_found);
+
+			// Mark the slot as used.
+			mMetadata[slot_index] = fingerprint;
+			mSlots[slot_index]    = mKeyValues.GetIndex(key_value);
+		}
+	}
+
+	// Internal function to find a key.
+	template <typename taAltKey>
+	Iter FindInternal(const taAltKey& inKey) const
+	{
+		if (Empty()) [[unlikely]]
+			return End();
+
+		// Try to find the key.
+		auto [slot_index, _, found] = FindSlot(inKey);
+
+		// If it was found, return an iterator.
+		if (found)
+			return mKeyValues.Begin() + mSlots[slot_index];
+
+		// Otherwise return End.
+		return End();
+	}
+
+	enum class EReplaceExisting
+	{
+		No,
+		Yes,
+	};
+
+	// Internal function to emplace a key and value.
+	template <EReplaceExisting taReplaceExisting, typename taAltKey, typename... taArgs>
+	InsertResult EmplaceInternal(taAltKey&& ioKey, taArgs&&... ioArgs)
+	{
+		if (IsFull()) [[unlikely]]
+			Grow(mMetadata.Size() * 2);
+		else if (GetNumUsedSlots() == mKeyValues.Capacity()) [[unlikely]]
+			Grow(mMetadata.Size()); // Same size, this just gets rid of the tombstones.
+
+		// Try to find the key.
+		auto [slot_index, fingerprint, found] = FindSlot(ioKey);
+
+		if (found)
+		{
+			// Key already exist.
+			KeyValue& key_value = mKeyValues[mSlots[slot_index]];
+
+			if constexpr (taReplaceExisting == EReplaceExisting::No || !cIsMap)
+			{
+				// Return the existing value.
+				return { key_value, EInsertResult::Found };
+			}
+			else
+			{
+				// Replace the existing value.
+				key_value.mValue = { gForward<taArgs>(ioArgs)... };
+				return { key_value, EInsertResult::Replaced };
+			}
+		}
+
+		// Key does not exist, add it.
+		mKeyValues.EmplaceBack(gForward<taAltKey>(ioKey), gForward<taArgs>(ioArgs)...);
+
+		// Mark the slot as used (it was either empty or a tombstone).
+		if (mMetadata[slot_index] == Details::cSwissDeleted)
+			mNumTombstones--;
+		mMetadata[slot_index] = fingerprint;
+		mSlots[slot_index]    = mKeyValues.Size() - 1;
+
+		KeyValue& key_value = mKeyValues.Back();
+		return { key_value, EInsertResult::Added };
+	}
+
+	// Internal function to erase a key.
+	template <typename taAltKey>
+	bool EraseInternal(const taAltKey& inKey)
+	{
+		if (Empty()) [[unlikely]]
+			return false;
+
+		// Try to find the key.
+		auto [slot_index, fingerprint, found] = FindSlot(inKey);
+
+		if (found == false)
+			return false; // Key does not exist.
+
+		int key_value_index_to_erase = mSlots[slot_index];
+
+		// Turn the slot into a tombstone (backward-shift deletion isn't possible with group probing).
+		mMetadata[slot_index] = Details::cSwissDeleted;
+		mNumTombstones++;
+
+		// If the key to erase is the last one, pop it and we're done.
+		if (key_value_index_to_erase == mKeyValues.Size() - 1)
+		{
+			mKeyValues.PopBack();
+			return true;
+		}
+
+		// Otherwise swap it with the last one, to minimize the number of moves.
+		int last_key_value_index = mKeyValues.Size() - 1;
+
+		// We also need to find the slot of the key we will swap to update its index.
+		FindSlotOfKeyValue(GetKey(mKeyValues.Back()), last_key_value_index, key_value_index_to_erase);
+
+		// Swap-erase the key-value.
+		mKeyValues.SwapErase(key_value_index_to_erase);
+
+		return true;
+	}
+
+
+	struct FindSlotResult
+	{
+		int    mSlotIndex;		// The slot where the key is or should be inserted.
+		uint8  mFingerprint;	// The metadata byte for this key.
+		bool   mFoundKey;		// True if the key was found at this slot.
+	};
+
+	// Find the slot where a key is (or should be inserted).
+	template <typename taAltKey>
+	FindSlotResult FindSlot(const taAltKey& inKey, bool inKeyMayBeFound = true) const
+	{
+		// Calculate the hash.
+		const uint64 hash        = taHash::operator()(inKey);
+		const uint8  fingerprint = sGetFingerprint(hash);
+
+		// Get the ideal group index.
+		// Note: The low 7 bits of the hash already went into the fingerprint, use the other bits for the index.
+		const int group_mask  = GetGroupMask();
+		int       group_index = (int)(hash >> 7) & group_mask;
+
+		// The first tombstone seen along the probe sequence, to reuse when inserting.
+		int insert_slot_index = -1;
+
+		// Probe group by group. Each group is compared in a single vector op:
+		// - matching fingerprints give candidate slots whose keys are compared
+		// - an empty slot means the probe sequence ends here (tombstones don't end it)
+		int probe_step = 1;
+		while (true)
+		{
+			const uint8* group = mMetadata.Data() + group_index * cGroupSize;
+
+			// Check all the candidates with a matching fingerprint.
+			// Note: inKeyMayBeFound = false is a special case when growing the map where we know the key won't be found.
+			if (inKeyMayBeFound)
+			{
+				uint32 match_mask = Details::gSwissMatchByte(group, fingerprint);
+				while (match_mask != 0)
+				{
+					int slot_index = group_index * cGroupSize + gCountTrailingZeros32(match_mask);
+					match_mask &= match_mask - 1; // Clear the lowest set bit.
+
+					if (GetKey(mKeyValues[mSlots[slot_index]]) == inKey) [[likely]]
+					{
+						// Found it.
+						return { slot_index, fingerprint, true };
+					}
+				}
+			}
+
+			// Remember the first tombstone seen, it's the best insertion spot.
+			if (insert_slot_index == -1)
+			{
+				uint32 deleted_mask = Details::gSwissMatchByte(group, Details::cSwissDeleted);
+				if (deleted_mask != 0) [[unlikely]]
+					insert_slot_index = group_index * cGroupSize + gCountTrailingZeros32(deleted_mask);
+			}
+
+			// If the group contains an empty slot, the key won't be found.
+			uint32 empty_mask = Details::gSwissMatchByte(group, Details::cSwissEmpty);
+			if (empty_mask != 0) [[likely]]
+			{
+				// Insert in the first tombstone seen, or in this empty slot.
+				if (insert_slot_index == -1)
+					insert_slot_index = group_index * cGroupSize + gCountTrailingZeros32(empty_mask);
+
+				return { insert_slot_index, fingerprint, false };
+			}
+
+			// Go to the next group (quadratic probing).
+			group_index = (group_index + probe_step) & group_mask;
+			probe_step++;
+		}
+	}
+
+	// Find the slot that references key-value index inKeyValueIndex and make it reference inNewKeyValueIndex instead.
+	void FindSlotOfKeyValue(const taKey& inKey, int inKeyValueIndex, int inNewKeyValueIndex)
+	{
+		const uint64 hash        = taHash::operator()(inKey);
+		const uint8  fingerprint = sGetFingerprint(hash);
+		const int    group_mask  = GetGroupMask();
+		int          group_index = (int)(hash >> 7) & group_mask;
+
+		int probe_step = 1;
+		while (true)
+		{
+			const uint8* group = mMetadata.Data() + group_index * cGroupSize;
+
+			// No need to compare keys, it's faster to just compare the key-value index. We know it will be found.
+			uint32 match_mask = Details::gSwissMatchByte(group, fingerprint);
+			while (match_mask != 0)
+			{
+				int slot_index = group_index * cGroupSize + gCountTrailingZeros32(match_mask);
+				match_mask &= match_mask - 1; // Clear the lowest set bit.
+
+				if (mSlots[slot_index] == inKeyValueIndex)
+				{
+					// Found it, update the index.
+					mSlots[slot_index] = inNewKeyValueIndex;
+					return;
+				}
+			}
+
+			gAssert(Details::gSwissMatchByte(group, Details::cSwissEmpty) == 0); // We should never encounter an empty slot.
+
+			// Go to the next group (quadratic probing).
+			group_index = (group_index + probe_step) & group_mask;
+			probe_step++;
+		}
+	}
+
+	using KeyValueVector = Vector<KeyValue, taAllocator<KeyValue>>;
+	using MetadataVector = Vector<uint8, taAllocator<uint8>>;
+	using SlotVector = Vector<int, taAllocator<int>>;
+
+	KeyValueVector	mKeyValues;			// Key-value pairs stored in a dense array.
+	MetadataVector	mMetadata;			// One byte per slot: empty, tombstone, or fingerprint.
+	SlotVector		mSlots;				// Index into mKeyValues for each slot.
+	int				mNumTombstones = 0;	// Number of tombstones in mMetadata.
+};
+
+
+// Alias for a SwissHashMap using the TempAllocator.
+// Resize without moving the Key/Values as long as it's the last Temp allocation (still needs a rehash). Allocates from the heap as a fallback.
+template <
+	typename taKey,
+	typename taValue,
+	typename taHash = Hash<taKey>
+>
+using TempSwissHashMap = SwissHashMap<taKey, taValue, taHash, TempAllocator>;
+
+
+// SwissHashSet variant of the SwissHashMap (no values).
+template <
+	typename taKey,
+	typename taHash = Hash<taKey>,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+using SwissHashSet = SwissHashMap<taKey, void, taHash, taAllocator>;
+
+
+// Alias for a SwissHashSet using the TempAllocator.
+template <
+	typename taKey,
+	typename taHash = Hash<taKey>
+>
+using TempSwissHashSet = SwissHashSet<taKey, taHash, TempAllocator>;
+
+
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
+SwissHashMap<taKey, taValue, taHash, taAllocator>::SwissHashMap(const SwissHashMap& inOther)
+{
+	*this = inOther;
+}
+
+
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
+SwissHashMap<taKey, taValue, taHash, taAllocator>& SwissHashMap<taKey, taValue, taHash, taAllocator>::operator=(
+	const SwissHashMap& inOther)
+{
+	Clear();
+
+	mKeyValues.Reserve(inOther.mKeyValues.Capacity());
+	mMetadata.Reserve(inOther.mMetadata.Capacity());
+	mSlots.Reserve(inOther.mSlots.Capacity());
+
+	mKeyValues     = inOther.mKeyValues;
+	mMetadata      = inOther.mMetadata;
+	mSlots         = inOther.mSlots;
+	mNumTombstones = inOther.mNumTombstones;
+
+	return *this;
+}
+
+
+template <typename taKey, typename taValue, typename taHash, template <typename> class taAllocator>
+void SwissHashMap<taKey, taValue, taHash, taAllocator>::Clear()
+{
+	mKeyValues.Clear();
+	mMetadata.Clear();
+	mMetadata.Resize(mMetadata.Capacity()); // Zero-initialized, so all slots are empty again.
+	mNumTombstones = 0;
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/Task.h>
+
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Semaphore.h>
+#include <Bedrock/Test.h>
+
+#include <stdio.h>
+
+
+static Task<int> sMakeAnswer()
+{
+	co_return 42;
+}
+
+
+static Task<int> sAddAnswers(int inCount)
+{
+	// Awaiting chains tasks through direct resumption, no callbacks involved.
+	int sum = 0;
+	for (int i = 0; i < inCount; i++)
+		sum += co_await sMakeAnswer();
+	co_return sum;
+}
+
+
+static Task<> sIncrement(int& ioValue)
+{
+	ioValue++;
+	co_return;
+}
+
+
+REGISTER_TEST("Task")
+{
+	// A task doesn't run until started.
+	int  value = 0;
+	{
+		Task<> task = sIncrement(value);
+		TEST_TRUE(task.IsValid());
+		TEST_FALSE(task.IsDone());
+		TEST_TRUE(value == 0);
+
+		task.Start();
+		TEST_TRUE(task.IsDone());
+		TEST_TRUE(value == 1);
+	}
+
+	// An unstarted task can be destroyed without running (and without leaking its frame).
+	{
+		Task<> task = sIncrement(value);
+	}
+	TEST_TRUE(value == 1);
+
+	// Results and chained awaits.
+	TEST_TRUE(gSyncRun(sMakeAnswer()) == 42);
+	TEST_TRUE(gSyncRun(sAddAnswers(10)) == 420);
+
+	// Move transfers ownership of the frame.
+	Task<int> task  = sMakeAnswer();
+	Task<int> moved = gMove(task);
+	TEST_FALSE(task.IsValid());
+	TEST_TRUE(gSyncRun(gMove(moved)) == 42);
+};
+
+
+REGISTER_TEST_SERIAL("Task Scheduler")
+{
+	TaskScheduler scheduler;
+	scheduler.Init({ .mNumWorkers = 2 });
+
+	// A detached task hops between workers and signals its completion itself.
+	AtomicInt32 num_steps = 0;
+	Semaphore   done      = { 0, 1 };
+
+	auto coro = [](TaskScheduler& ioScheduler, AtomicInt32& ioNumSteps, Semaphore& ioDone) -> Task<> {
+		ioNumSteps.Add(1);
+		co_await gResumeOn(ioScheduler); // Hop to another worker task.
+		ioNumSteps.Add(1);
+		co_await gResumeOn(ioScheduler);
+		ioNumSteps.Add(1);
+		ioDone.Release();
+	};
+
+	gRunDetached(scheduler, coro(scheduler, num_steps, done));
+
+	done.Acquire();
+	TEST_TRUE(num_steps.Load() == 3);
+
+	scheduler.Shutdown();
+};
+
+
+REGISTER_TEST("Task AsyncIO")
+{
+	// Write a small test file.
+	const char* test_path = "bedrock_task_async_io_test.tmp";
+	{
+		FILE* file = fopen(test_path, "wb");
+		TEST_TRUE(file != nullptr);
+		for (int i = 0; i < 100; i++)
+			fwrite(&i, sizeof(i), 1, file);
+		fclose(file);
+	}
+
+	AsyncIOQueue queue;
+	AsyncFile    file;
+	TEST_TRUE(queue.Open(test_path, file));
+
+	// A coroutine that awaits two reads in sequence; it suspends at each one and is resumed by
+	// the completion pump below.
+	auto coro = [](AsyncIOQueue& ioQueue, AsyncFile& ioFile) -> Task<int> {
+		int values[2] = {};
+
+		Span<uint8> first = co_await gReadAsync(ioQueue, ioFile, 10 * sizeof(int), Span((uint8*)&values[0], (int)sizeof(int)));
+		Span<uint8> second = co_await gReadAsync(ioQueue, ioFile, 20 * sizeof(int), Span((uint8*)&values[1], (int)sizeof(int)));
+		TEST_TRUE(first.Size() == sizeof(int));
+		TEST_TRUE(second.Size() == sizeof(int));
+
+		// A read past the end resumes immediately with no bytes.
+		uint8       dummy[4];
+		Span<uint8> past_end = co_await gReadAsync(ioQueue, ioFile, ioFile.GetSize() + 100, Span(dummy));
+		TEST_TRUE(past_end.Empty());
+
+		co_return values[0] + values[1];
+	};
+
+	Task<int> task = coro(queue, file);
+	task.Start(); // Runs until the first read suspends.
+	TEST_FALSE(task.IsDone());
+
+	// Pump completions until the task ran to the end.
+	while (!task.IsDone())
+		queue.Wait();
+
+	TEST_TRUE(task.GetResult() == 10 + 20);
+
+	file.Close();
+	remove(test_path);
+};
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/AsyncIO.h>
+#include <Bedrock/Core.h>
+#include <Bedrock/Memory.h>
+#include <Bedrock/Move.h>
+#include <Bedrock/TaskScheduler.h>
+#include <Bedrock/TypeTraits.h>
+
+// The one STL header coroutines can't be written without: the compiler requires
+// std::coroutine_handle and std::coroutine_traits to come from it.
+#include <coroutine>
+
+
+template <typename taResult>
+struct Task;
+
+namespace Details
+{
+	// Part of the promise that doesn't depend on the result type.
+	struct TaskPromiseBase
+	{
+		// Coroutine frames go through the thread-cached allocator instead of hitting the global
+		// heap lock; typical frames fit its pooled size classes.
+		void* operator new(size_t inSize) { return gMemAlloc((int64)inSize).mPtr; }
+		void  operator delete(void* inPtr, size_t inSize) { gMemFree({ (uint8*)inPtr, (int64)inSize }); }
+
+		std::suspend_always initial_suspend() noexcept { return {}; } // Tasks are lazy, they run when awaited (or started).
+		void                unhandled_exception() noexcept {}         // Bedrock doesn't use exceptions.
+
+		std::coroutine_handle<> mContinuation = nullptr; // Resumed when this task finishes.
+		bool                    mDetached     = false;   // Detached tasks destroy their own frame when they finish.
+	};
+
+
+	// Resumes the awaiting coroutine (by symmetric transfer) when a task reaches its end.
+	template <typename taPromise>
+	struct TaskFinalAwaiter
+	{
+		bool await_ready() noexcept { return false; }
+		void await_resume() noexcept {}
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<taPromise> inHandle) noexcept
+		{
+			TaskPromiseBase& promise = inHandle.promise();
+
+			if (promise.mContinuation != nullptr)
+				return promise.mContinuation;
+
+			// No one is awaiting; a detached task cleans up after itself.
+			if (promise.mDetached)
+				inHandle.destroy();
+
+			return std::noop_coroutine();
+		}
+	};
+
+
+	// Result storage, specialized for void below.
+	template <typename taResult>
+	struct TaskPromiseStorage : TaskPromiseBase
+	{
+		void return_value(taResult ioValue) { mResult = gMove(ioValue); }
+
+		taResult mResult = {};
+	};
+
+	template <>
+	struct TaskPromiseStorage<void> : TaskPromiseBase
+	{
+		void return_void() {}
+	};
+}
+
+
+// Coroutine task.
+// A Task is lazy: it starts running when co_awaited (from another task) or when Start is called.
+// Awaiting a task suspends the caller until the task finishes and yields its result, all through
+// direct coroutine resumption: no Function wrapper, no heap allocation per stage, one pooled
+// allocation per coroutine frame. See gRunDetached to run one on a TaskScheduler and gReadAsync
+// to await an asynchronous file read.
+template <typename taResult = void>
+struct [[nodiscard]] Task : NoCopy
+{
+	struct Promise : Details::TaskPromiseStorage<taResult>
+	{
+		Task get_return_object() { return Task(std::coroutine_handle<Promise>::from_promise(*this)); }
+
+		Details::TaskFinalAwaiter<Promise> final_suspend() noexcept { return {}; }
+	};
+	using promise_type = Promise;
+
+	Task() = default;
+	~Task()
+	{
+		// Only suspended (or never started) tasks can be destroyed.
+		if (mHandle != nullptr)
+			mHandle.destroy();
+	}
+
+	// Move
+	Task(Task&& ioOther) { mHandle = ioOther.mHandle; ioOther.mHandle = nullptr; }
+	Task& operator=(Task&& ioOther)
+	{
+		if (mHandle != nullptr)
+			mHandle.destroy();
+		mHandle = ioOther.mHandle;
+		ioOther.mHandle = nullptr;
+		return *this;
+	}
+
+	bool IsValid() const { return mHandle != nullptr; }
+	bool IsDone() const { gAssert(IsValid()); return mHandle.done(); }
+
+	// Run the task on this thread until it finishes or suspends (eg. on an async read).
+	void Start()
+	{
+		gAssert(IsValid() && !IsDone());
+		mHandle.resume();
+	}
+
+	// Get the result. The task must be done.
+	taResult& GetResult() requires (!cIsVoid<taResult>)
+	{
+		gAssert(IsDone());
+		return mHandle.promise().mResult;
+	}
+
+	// Awaiting a task starts it and suspends the awaiter until it finishes.
+	auto operator co_await() &&
+	{
+		struct Awaiter
+		{
+			std::coroutine_handle<Promise> mHandle;
+
+			bool await_ready() { return mHandle.done(); }
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> inContinuation)
+			{
+				mHandle.promise().mContinuation = inContinuation;
+				return mHandle; // Symmetric transfer: run the awaited task now.
+			}
+
+			taResult await_resume()
+			{
+				if constexpr (!cIsVoid<taResult>)
+					return gMove(mHandle.promise().mResult);
+			}
+		};
+
+		gAssert(IsValid());
+		return Awaiter{ mHandle };
+	}
+
+private:
+	template <typename> friend struct Task;
+	friend void gRunDetached(TaskScheduler&, Task<void>&&);
+
+	explicit Task(std::coroutine_handle<Promise> inHandle) : mHandle(inHandle) {}
+
+	std::coroutine_handle<Promise> mHandle = nullptr;
+};
+
+
+// Run a task synchronously to completion and return its result.
+// The task must not await anything resumed externally (async reads, gResumeOn), only other tasks.
+template <typename taResult>
+taResult gSyncRun(Task<taResult>&& ioTask)
+{
+	ioTask.Start();
+	gAssert(ioTask.IsDone());
+
+	if constexpr (!cIsVoid<taResult>)
+		return gMove(ioTask.GetResult());
+}
+
+
+// Run a task on the scheduler's workers, detached: the task owns itself and frees its frame when
+// it finishes. Use your own signal (eg. a Semaphore) to observe completion.
+inline void gRunDetached(TaskScheduler& ioScheduler, Task<void>&& ioTask)
+{
+	gAssert(ioTask.IsValid());
+
+	// The coroutine owns itself from here on.
+	std::coroutine_handle<> handle = ioTask.mHandle;
+	ioTask.mHandle.promise().mDetached = true;
+	ioTask.mHandle = nullptr;
+
+	ioScheduler.Submit([handle] { handle.resume(); });
+}
+
+
+// Awaitable that suspends the current task and resumes it as a task on the scheduler's workers.
+// Use it to hop a coroutine onto (or between) worker threads.
+inline auto gResumeOn(TaskScheduler& ioScheduler)
+{
+	struct Awaiter
+	{
+		TaskScheduler* mScheduler;
+
+		bool await_ready() { return false; }
+		void await_suspend(std::coroutine_handle<> inHandle) { mScheduler->Submit([inHandle] { inHandle.resume(); }); }
+		void await_resume() {}
+	};
+
+	return Awaiter{ &ioScheduler };
+}
+
+
+// Awaitable asynchronous file read (see AsyncIOQueue::ReadAsync).
+// The task resumes when the read completes, during the queue's Poll/Wait (or on a worker if the
+// queue dispatches through a TaskScheduler), and gets the bytes that were read (empty on failure).
+// If the read can't even be submitted (eg. offset past the end), the task resumes immediately.
+inline auto gReadAsync(AsyncIOQueue& ioQueue, AsyncFile& ioFile, int64 inOffset, Span<uint8> outBuffer)
+{
+	struct Awaiter
+	{
+		AsyncIOQueue* mQueue;
+		AsyncFile*    mFile;
+		int64         mOffset;
+		Span<uint8>   mBuffer;
+		int           mBytesRead = 0;
+
+		bool await_ready() { return false; }
+
+		bool await_suspend(std::coroutine_handle<> inHandle)
+		{
+			return mQueue->ReadAsync(*mFile, mOffset, mBuffer, [this, inHandle](bool inSuccess, Span<uint8> inBytes) {
+				mBytesRead = inSuccess ? inBytes.Size() : 0;
+				inHandle.resume();
+			});
+			// Returning false (submission failed) resumes immediately with zero bytes.
+		}
+
+		Span<uint8> await_resume() { return { mBuffer.Data(), mBytesRead }; }
+	};
+
+	return Awaiter{ &ioQueue, &ioFile, inOffset, outBuffer };
+}
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/TaskScheduler.h>
+#include <Bedrock/Memory.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+
+
+TaskScheduler* TaskScheduler::sDefaultScheduler = nullptr;
+
+// Which scheduler the current thread is registered with, and its worker index there.
+static thread_local TaskScheduler* sCurrentScheduler   = nullptr;
+static thread_local int            sCurrentWorkerIndex = -1;
+
+static constexpr int cTasksPerChunk = 64; // Task nodes are allocated in chunks of that many.
+
+
+TaskScheduler::~TaskScheduler()
+{
+	if (IsInitialized())
+		Shutdown();
+}
+
+
+void TaskScheduler::Init(const TaskSchedulerConfig& inConfig)
+{
+	gAssert(!IsInitialized());
+	gAssert(sCurrentScheduler == nullptr); // The calling thread is already registered with a scheduler.
+
+	int num_workers = inConfig.mNumWorkers;
+	if (num_workers <= 0)
+		num_workers = gMax(1, gThreadHardwareConcurrency() - 1);
+
+	// One deque per worker thread, plus one for the calling thread (index 0).
+	mWorkerDeques.Reserve(num_workers + 1);
+	for (int i = 0; i < num_workers + 1; i++)
+	{
+		auto deque = (Details::TaskDeque*)gMemAlloc(sizeof(Details::TaskDeque)).mPtr;
+		gPlacementNew(*deque);
+		mWorkerDeques.PushBack(deque);
+	}
+
+	// Register the calling thread as worker 0.
+	sCurrentScheduler   = this;
+	sCurrentWorkerIndex = 0;
+
+	mStopRequested.Store(false);
+
+	// Start the worker threads.
+	mWorkerThreads    = (Thread*)gMemAlloc(num_workers * sizeof(Thread)).mPtr;
+	mNumWorkerThreads = num_workers;
+	for (int i = 0; i < num_workers; i++)
+	{
+		gPlacementNew(mWorkerThreads[i]);
+		mWorkerThreads[i].Create(
+			{
+				.mName        = gTempFormat("Worker%d", i),
+				.mTempMemSize = inConfig.mTempMemSize,
+			},
+			[this, worker_index = i + 1](Thread&) { WorkerLoop(worker_index); });
+	}
+
+	if (sDefaultScheduler == nullptr)
+		sDefaultScheduler = this;
+}
+
+
+void TaskScheduler::Shutdown()
+{
+	gAssert(IsInitialized());
+	gAssert(sCurrentScheduler == this && sCurrentWorkerIndex == 0); // Shutdown from the thread that called Init.
+
+	// Finish the tasks still in the deques.
+	while (mWakeSemaphore.TryAcquire())
+		ExecuteTask(FindTask(0));
+
+	// Stop the workers. Extra semaphore tokens wake them up so they see the stop request.
+	mStopRequested.Store(true);
+	mWakeSemaphore.Release(mNumWorkerThreads);
+
+	for (int i = 0; i < mNumWorkerThreads; i++)
+	{
+		mWorkerThreads[i].Join();
+		mWorkerThreads[i].~Thread();
+	}
+	gMemFree({ (uint8*)mWorkerThreads, mNumWorkerThreads * (int64)sizeof(Thread) });
+	mWorkerThreads    = nullptr;
+	mNumWorkerThreads = 0;
+
+	sCurrentScheduler   = nullptr;
+	sCurrentWorkerIndex = -1;
+
+	for (Details::TaskDeque* deque : mWorkerDeques)
+	{
+		deque->~TaskDeque();
+		gMemFree({ (uint8*)deque, sizeof(Details::TaskDeque) });
+	}
+	mWorkerDeques.Clear();
+
+	// Free the task nodes.
+	mFreeTasks = nullptr;
+	for (MemBlock chunk : mTaskChunks)
+		gMemFree(chunk);
+	mTaskChunks.Clear();
+
+	if (sDefaultScheduler == this)
+		sDefaultScheduler = nullptr;
+}
+
+
+void TaskScheduler::Submit(Function<void()>&& ioTask, TaskCounter* ioCounter)
+{
+	int worker_index = GetCurrentWorkerIndex();
+	gAssert(worker_index != -1); // Submit is only allowed from registered threads.
+
+	if (ioCounter != nullptr)
+		ioCounter->mCount.Add(1);
+
+	Details::Task* task = AllocTask();
+	task->mFunction     = gMove(ioTask);
+	task->mCounter      = ioCounter;
+
+	if (mWorkerDeques[worker_index]->TryPush(task)) [[likely]]
+	{
+		// Wake a worker. One semaphore token exists per task in the deques.
+		mWakeSemaphore.Release();
+	}
+	else
+	{
+		// The deque is full, just run the task here and now.
+		ExecuteTask(task);
+	}
+}
+
+
+void TaskScheduler::Wait(TaskCounter& inCounter)
+{
+	int worker_index = GetCurrentWorkerIndex();
+	gAssert(worker_index != -1); // Wait is only allowed from registered threads.
+
+	while (!inCounter.IsDone())
+	{
+		// Help with other tasks instead of blocking.
+		if (mWakeSemaphore.TryAcquire())
+			ExecuteTask(FindTask(worker_index));
+		else
+			gYieldThread();
+	}
+}
+
+
+Details::Task* TaskScheduler::AllocTask()
+{
+	LockGuard lock(mFreeTasksMutex);
+
+	if (mFreeTasks == nullptr)
+	{
+		// Allocate a new chunk of task nodes and add them to the free list.
+		MemBlock chunk = gMemAlloc(cTasksPerChunk * sizeof(Details::Task));
+		mTaskChunks.PushBack(chunk);
+
+		auto tasks = (Details::Task*)chunk.mPtr;
+		for (int i = 0; i < cTasksPerChunk; i++)
+		{
+			gPlacementNew(tasks[i]);
+			tasks[i].mNextFree = mFreeTasks;
+			mFreeTasks         = &tasks[i];
+		}
+	}
+
+	Details::Task* task = mFreeTasks;
+	mFreeTasks          = task->mNextFree;
+	task->mNextFree     = nullptr;
+	return task;
+}
+
+
+void TaskScheduler::FreeTask(Details::Task* inTask)
+{
+	inTask->mFunction = {};
+	inTask->mCounter  = nullptr;
+
+	LockGuard lock(mFreeTasksMutex);
+
+	inTask->mNextFree = mFreeTasks;
+	mFreeTasks        = inTask;
+}
+
+
+// Find a task, looping over all the deques until one is found.
+// Only call after acquiring a semaphore token: the token guarantees one task is reachable.
+Details::Task* TaskScheduler::FindTask(int inWorkerIndex)
+{
+	while (true)
+	{
+		// Own deque first (LIFO, best cache locality).
+		if (Details::Task* task = mWorkerDeques[inWorkerIndex]->TryPop())
+			return task;
+
+		// Then try stealing from the other workers (FIFO).
+		int num_deques = mWorkerDeques.Size();
+		for (int i = 1; i < num_deques; i++)
+		{
+			int victim = (inWorkerIndex + i) % num_deques;
+			if (Details::Task* task = mWorkerDeques[victim]->TrySteal())
+				return task;
+		}
+
+		// Everything looked empty. Another thread holding a token may be about to take
+		// "our" task, or a steal lost a race; either way a task will show up, retry.
+		gYieldThread();
+	}
+}
+
+
+void TaskScheduler::ExecuteTask(Details::Task* inTask)
+{
+	inTask->mFunction();
+
+	if (inTask->mCounter != nullptr)
+		inTask->mCounter->mCount.Sub(1);
+
+	FreeTask(inTask);
+}
+
+
+int TaskScheduler::GetCurrentWorkerIndex() const
+{
+	return (sCurrentScheduler == this) ? sCurrentWorkerIndex : -1;
+}
+
+
+void TaskScheduler::WorkerLoop(int inWorkerIndex)
+{
+	sCurrentScheduler   = this;
+	sCurrentWorkerIndex = inWorkerIndex;
+
+	while (true)
+	{
+		mWakeSemaphore.Acquire();
+
+		if (mStopRequested.Load()) [[unlikely]]
+			break;
+
+		ExecuteTask(FindTask(inWorkerIndex));
+	}
+
+	sCurrentScheduler   = nullptr;
+	sCurrentWorkerIndex = -1;
+}
+
+
+REGISTER_TEST_SERIAL("TaskScheduler")
+{
+	TaskScheduler scheduler;
+	scheduler.Init({ .mNumWorkers = 3 });
+	TEST_TRUE(scheduler.GetNumWorkers() == 4); // 3 workers + the calling thread.
+	TEST_TRUE(TaskScheduler::sGetDefault() == &scheduler);
+
+	// Run a bunch of tasks incrementing an atomic counter.
+	constexpr int cNumTasks = 1000;
+	AtomicInt32	  sum	    = 0;
+	TaskCounter	  counter;
+
+	for (int i = 0; i < cNumTasks; i++)
+		scheduler.Submit([&sum] { sum.Add(1); }, &counter);
+
+	scheduler.Wait(counter);
+	TEST_TRUE(counter.IsDone());
+	TEST_TRUE(sum.Load() == cNumTasks);
+
+	// Tasks can submit tasks themselves (fork-join).
+	AtomicInt32 nested_sum = 0;
+	TaskCounter nested_counter;
+	for (int i = 0; i < 100; i++)
+	{
+		scheduler.Submit(
+			[&scheduler, &nested_sum, &nested_counter]
+			{
+				for (int j = 0; j < 10; j++)
+					scheduler.Submit([&nested_sum] { nested_sum.Add(1); }, &nested_counter);
+			},
+			&nested_counter);
+	}
+
+	scheduler.Wait(nested_counter);
+	TEST_TRUE(nested_sum.Load() == 1000);
+
+	scheduler.Shutdown();
+	TEST_TRUE(!scheduler.IsInitialized());
+	TEST_TRUE(TaskScheduler::sGetDefault() == nullptr);
+};
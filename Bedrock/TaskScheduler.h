@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Atomic.h>
+#include <Bedrock/Function.h>
+#include <Bedrock/Mutex.h>
+#include <Bedrock/Semaphore.h>
+#include <Bedrock/Thread.h>
+#include <Bedrock/Vector.h>
+
+
+struct TaskScheduler;
+struct TaskCounter;
+
+namespace Details
+{
+	// A task as stored internally by the scheduler.
+	struct Task
+	{
+		Function<void()> mFunction;
+		TaskCounter*     mCounter  = nullptr; // Optional counter decremented when the task finishes.
+		Task*            mNextFree = nullptr; // Free list link, used when the task is not in flight.
+	};
+
+
+	// Chase-Lev work-stealing deque. The owning worker pushes and pops at the bottom (LIFO),
+	// other workers steal from the top (FIFO). Fixed capacity, stores Task pointers only.
+	// Note: The publication points (mTop, and mBottom where stealers read it) use SeqCst, which the
+	// owner/stealer races rely on; owner-only accesses and the slots themselves are Relaxed (slot
+	// contents are published by the SeqCst store to mBottom).
+	struct TaskDeque : NoCopy
+	{
+		static constexpr int cCapacity = 4096; // Max tasks in flight per worker. Power of 2.
+
+		// Push a task at the bottom. Owner thread only. Returns false if the deque is full.
+		bool TryPush(Task* inTask)
+		{
+			int64 bottom = mBottom.Load(MemoryOrder::Relaxed);
+			int64 top    = mTop.Load();
+
+			if (bottom - top >= cCapacity)
+				return false;
+
+			mSlots[bottom & (cCapacity - 1)].Store(inTask, MemoryOrder::Relaxed);
+			mBottom.Store(bottom + 1);
+			return true;
+		}
+
+		// Pop a task from the bottom. Owner thread only. Returns nullptr if the deque is empty.
+		Task* TryPop()
+		{
+			int64 bottom = mBottom.Load(MemoryOrder::Relaxed) - 1;
+			mBottom.Store(bottom);
+			int64 top = mTop.Load();
+
+			if (top > bottom)
+			{
+				// Deque was empty, restore bottom.
+				mBottom.Store(bottom + 1);
+				return nullptr;
+			}
+
+			Task* task = mSlots[bottom & (cCapacity - 1)].Load(MemoryOrder::Relaxed);
+
+			if (top != bottom)
+				return task; // More than one element left, no race with stealers possible.
+
+			// Single element left, race with stealers for it by advancing top.
+			int64 expected = top;
+			bool  won      = mTop.CompareExchange(expected, top + 1);
+			mBottom.Store(bottom + 1);
+			return won ? task : nullptr;
+		}
+
+		// Steal a task from the top. Any thread. Returns nullptr if the deque is empty or the steal lost a race.
+		Task* TrySteal()
+		{
+			int64 top    = mTop.Load();
+			int64 bottom = mBottom.Load();
+
+			if (top >= bottom)
+				return nullptr;
+
+			Task* task     = mSlots[top & (cCapacity - 1)].Load(MemoryOrder::Relaxed);
+			int64 expected = top;
+
+			if (mTop.CompareExchange(expected, top + 1))
+				return task;
+
+			return nullptr; // Lost the race against the owner or another stealer.
+		}
+
+	private:
+		alignas(64) Atomic<int64> mTop     = 0; // Stealers advance this. On its own cache line.
+		alignas(64) Atomic<int64> mBottom  = 0; // Owner advances this.
+		Atomic<Task*>             mSlots[cCapacity] = {};
+	};
+}
+
+
+// Tracks the completion of a group of tasks submitted to a TaskScheduler.
+struct TaskCounter : NoCopy
+{
+	bool IsDone() const { return mCount.Load() == 0; }
+
+private:
+	friend struct TaskScheduler;
+	AtomicInt32 mCount = 0;
+};
+
+
+struct TaskSchedulerConfig
+{
+	int mNumWorkers  = 0;       // Number of worker threads. 0 means one per hardware thread, minus one for the calling thread.
+	int mTempMemSize = 128_KiB; // Size of the temp memory allocated for each worker thread. Can be 0.
+};
+
+
+// Work-stealing task scheduler.
+// Each worker thread owns a deque; tasks are pushed LIFO on the submitting worker's deque and
+// idle workers steal FIFO from the others. The thread calling Init is registered as a worker
+// too (index 0), so it can submit tasks and help executing them while waiting on a TaskCounter.
+// Tasks may only be submitted from registered threads (the Init thread or task code itself).
+struct TaskScheduler : NoCopy
+{
+	TaskScheduler() = default;
+	~TaskScheduler();
+
+	// Start the worker threads and register the calling thread as worker 0.
+	void Init(const TaskSchedulerConfig& inConfig = {});
+
+	// Wait for the in-flight tasks to finish, then stop and join the worker threads.
+	void Shutdown();
+
+	bool IsInitialized() const { return !mWorkerDeques.Empty(); }
+
+	// Total number of workers, including the thread that called Init.
+	int  GetNumWorkers() const { return mWorkerDeques.Size(); }
+
+	// Submit a task. If ioCounter is provided, it is incremented now and decremented when the task finishes.
+	// Must be called from a registered thread.
+	void Submit(Function<void()>&& ioTask, TaskCounter* ioCounter = nullptr);
+
+	// Wait until the counter reaches zero, executing other tasks in the meantime.
+	// Must be called from a registered thread.
+	void Wait(TaskCounter& inCounter);
+
+	// Get the default scheduler (the last one initialized), or null if there isn't one.
+	static TaskScheduler* sGetDefault() { return sDefaultScheduler; }
+
+private:
+	Details::Task* AllocTask();
+	void           FreeTask(Details::Task* inTask);
+	Details::Task* FindTask(int inWorkerIndex);       // Loop over the deques until a task is found.
+	void           ExecuteTask(Details::Task* inTask);
+	int            GetCurrentWorkerIndex() const;     // -1 if the current thread is not registered.
+	void           WorkerLoop(int inWorkerIndex);
+
+	Vector<Details::TaskDeque*> mWorkerDeques;             // One per worker, index 0 belongs to the Init thread.
+	Thread*                     mWorkerThreads    = nullptr; // Allocated array (Thread is not movable so it can't go in a Vector).
+	int                         mNumWorkerThreads = 0;
+	Semaphore                   mWakeSemaphore = { 0, cMaxInt }; // One token per task in the deques.
+	AtomicBool                  mStopRequested = false;
+	Mutex                       mFreeTasksMutex;
+	Details::Task*              mFreeTasks     = nullptr;  // Free list of task nodes, guarded by mFreeTasksMutex.
+	Vector<MemBlock>            mTaskChunks;               // Allocations backing the task nodes, guarded by mFreeTasksMutex.
+
+	static TaskScheduler*       sDefaultScheduler;
+};
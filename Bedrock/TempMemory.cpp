@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/TempMemory.h>
 
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Test.h>
+
 
 void gThreadInitTempMemory(MemBlock inMemory)
 {
@@ -15,10 +18,155 @@ MemBlock gThreadExitTempMemory()
 	// Everything should be freed before exiting (or not initialized).
 	gAssert(gTempMemArena.GetAllocatedSize() == 0);
 
+	// Release any overflow block still chained (empty at this point, but only rewinds release them).
+	gTempMemArena.Rewind({});
+
 	MemBlock mem_block = gTempMemArena.GetMemBlock();
 	gTempMemArena      = {};
 	return mem_block;
 }
 
 
+MemBlock TempMemArena::AllocOverflow(int inSize)
+{
+	// The header is stored at the start of the block, the arena allocates from the rest.
+	constexpr int64 cHeaderSize = gAlignUp((int64)sizeof(Details::TempOverflowBlock), cAlignment);
+
+	// New blocks are the size of the initial block, or larger if the allocation needs it.
+	// One big heap allocation per overflow instead of one per temp allocation.
+	int64    block_size = gMax(GetMemBlock().mSize, cHeaderSize + gAlignUp(inSize, cAlignment));
+	MemBlock block_mem  = gMemAlloc(block_size);
+	gAssert(((uint64)block_mem.mPtr % cAlignment) == 0);
+
+	Details::TempOverflowBlock* block = (Details::TempOverflowBlock*)block_mem.mPtr;
+	gPlacementNew(*block);
+	block->mPrev      = mCurrentOverflow;
+	block->mBlockSize = block_mem.mSize;
+	block->mArena     = MemArena<>({ block_mem.mPtr + cHeaderSize, block_mem.mSize - cHeaderSize });
+
+	mCurrentOverflow = block;
+
+	return block->mArena.Alloc(inSize);
+}
+
+
+void TempMemArena::FreeOverflowBlocks(Details::TempOverflowBlock* inKeepBlock)
+{
+	while (mCurrentOverflow != inKeepBlock)
+	{
+		Details::TempOverflowBlock* block = mCurrentOverflow;
+		mCurrentOverflow = block->mPrev;
+
+		// Drop whatever the block still holds (the caller is rewinding past it).
+		block->mArena.Rewind(0);
+
+		MemBlock block_mem = { (uint8*)block, block->mBlockSize };
+		block->~TempOverflowBlock();
+		gMemFree(block_mem);
+	}
+}
+
+
+REGISTER_TEST("TempMemScope")
+{
+	TEST_INIT_TEMP_MEMORY(1_KiB);
+
+	int base_size = gTempMemArena.GetAllocatedSize();
+
+	{
+		TempMemScope scope;
+
+		// Allocate out of order and don't free everything: the scope rewinds it all.
+		MemBlock b1 = gTempMemArena.Alloc(64);
+		MemBlock b2 = gTempMemArena.Alloc(64);
+		MemBlock b3 = gTempMemArena.Alloc(64);
+		TEST_TRUE(b1 != nullptr && b2 != nullptr && b3 != nullptr);
+
+		gTempMemArena.Free(b1); // Out of order, stays pending.
+		TEST_TRUE(gTempMemArena.GetNumPendingFree() == 1);
+	}
+
+	TEST_TRUE(gTempMemArena.GetAllocatedSize() == base_size);
+	TEST_TRUE(gTempMemArena.GetNumPendingFree() == 0);
+
+	// Nested scopes only rewind their own allocations.
+	{
+		TempMemScope outer;
+		MemBlock outer_block = gTempMemArena.Alloc(16);
+		{
+			TempMemScope inner;
+			gTempMemArena.Alloc(128);
+			gTempMemArena.Alloc(128);
+		}
+		TEST_TRUE(gTempMemArena.IsLastAlloc(outer_block));
+	}
+	TEST_TRUE(gTempMemArena.GetAllocatedSize() == base_size);
+};
+
+
+REGISTER_TEST("TempMemArena Overflow")
+{
+	TEST_INIT_TEMP_MEMORY(1_KiB);
+
+	int    base_size  = gTempMemArena.GetAllocatedSize();
+	uint8* base_begin = gTempMemArena.GetMemBlock().mPtr;
+	uint8* base_end   = base_begin + gTempMemArena.GetMemBlock().mSize;
+
+	{
+		TempMemScope scope;
+
+		// Exhaust the 1 KiB initial block: allocations keep succeeding from chained overflow blocks.
+		MemBlock blocks[8];
+		for (int i = 0; i < (int)gElemCount(blocks); i++)
+		{
+			blocks[i] = gTempMemArena.Alloc(400);
+			TEST_TRUE(blocks[i] != nullptr);
+			TEST_TRUE(gTempMemArena.Owns(blocks[i].mPtr));
+
+			// Fill each block with a distinct pattern to detect overlaps.
+			gMemSet(blocks[i].mPtr, (uint8)i, (int)blocks[i].mSize);
+		}
+
+		// Most of these landed outside the initial block.
+		TEST_TRUE(blocks[7].mPtr < base_begin || blocks[7].mPtr >= base_end);
+		TEST_TRUE(gTempMemArena.GetAllocatedSize() >= base_size + 8 * 400);
+
+		for (int i = 0; i < (int)gElemCount(blocks); i++)
+			for (int j = 0; j < blocks[i].mSize; j++)
+				TEST_TRUE(blocks[i].mPtr[j] == (uint8)i);
+
+		// Free and realloc work wherever the allocation landed.
+		TEST_TRUE(gTempMemArena.IsLastAlloc(blocks[7]));
+		TEST_TRUE(gTempMemArena.TryRealloc(blocks[7], 410));
+		gTempMemArena.Free(blocks[7]);
+		gTempMemArena.Free(blocks[2]); // Out of order, stays pending in its own block.
+	}
+
+	// The scope rewind released the overflow blocks.
+	TEST_TRUE(gTempMemArena.GetAllocatedSize() == base_size);
+
+	// An allocation larger than the initial block gets a block of its own.
+	{
+		TempMemScope scope;
+
+		MemBlock big = gTempMemArena.Alloc(4096);
+		TEST_TRUE(big != nullptr);
+		TEST_TRUE(big.mSize == 4096);
+		TEST_TRUE(gTempMemArena.Owns(big.mPtr));
+	}
 
+	// Inner scopes only release the blocks chained after their savepoint.
+	{
+		TempMemScope outer;
+		MemBlock outer_block = gTempMemArena.Alloc(900); // Nearly fills the initial block.
+		{
+			TempMemScope inner;
+			MemBlock inner_block = gTempMemArena.Alloc(900); // Overflows.
+			TEST_TRUE(inner_block != nullptr);
+			TEST_TRUE(inner_block.mPtr < base_begin || inner_block.mPtr >= base_end);
+		}
+		TEST_TRUE(gTempMemArena.IsLastAlloc(outer_block)); // Back on the initial block.
+		gTempMemArena.Free(outer_block);
+	}
+	TEST_TRUE(gTempMemArena.GetAllocatedSize() == base_size);
+};
@@ -11,8 +11,179 @@ void gThreadInitTempMemory(MemBlock inMemory);
 // De-initialize temporary memory for the current thread.
 [[nodiscard]] MemBlock gThreadExitTempMemory();
 
-// Thread-local arena that can be used for allocating temporary memory.
-using TempMemArena = MemArena<>;
+
+namespace Details
+{
+	// Header placed at the start of each overflow block chained by a TempMemArena.
+	struct TempOverflowBlock
+	{
+		TempOverflowBlock* mPrev      = nullptr; // Previous overflow block (full), or nullptr if this is the first.
+		int64              mBlockSize = 0;       // Size of the entire heap block, header included.
+		MemArena<>         mArena;               // Arena allocating from the rest of the block.
+	};
+}
+
+
+// Thread-local arena used for allocating temporary memory.
+// When the initial block is exhausted, the arena chains in an extra arena-sized heap block and
+// keeps bump-allocating from it (instead of failing and sending every following allocation to the
+// heap individually). Overflow blocks are released when a TempMemScope rewinds past them, or at
+// thread exit.
+struct TempMemArena : MemArena<>
+{
+	using Base = MemArena<>;
+
+	// Position in the arena, captured by TempMemScope to rewind to later.
+	struct Savepoint
+	{
+		Details::TempOverflowBlock* mOverflowBlock = nullptr; // Overflow block that was current at capture (nullptr = none).
+		int                         mAllocatedSize = 0;       // Allocated size inside that block (or the initial block).
+	};
+
+	TempMemArena() = default;
+	TempMemArena(MemBlock inMemory) : Base(inMemory) {}
+	~TempMemArena() { gAssert(mCurrentOverflow == nullptr); } // Overflow blocks should be rewound before destruction.
+
+	// Not copyable
+	TempMemArena(const TempMemArena&)            = delete;
+	TempMemArena& operator=(const TempMemArena&) = delete;
+
+	// Move
+	TempMemArena(TempMemArena&& ioOther) { operator=((TempMemArena&&)ioOther); }
+	TempMemArena& operator=(TempMemArena&& ioOther)
+	{
+		gAssert(mCurrentOverflow == nullptr);
+
+		Base::operator=((Base&&)ioOther);
+
+		mCurrentOverflow         = ioOther.mCurrentOverflow;
+		ioOther.mCurrentOverflow = nullptr;
+
+		return *this;
+	}
+
+	// Allocate memory. Never fails: when the current block is exhausted, a new one is chained in.
+	MemBlock Alloc(int inSize)
+	{
+		// Once overflow blocks exist, everything goes to the newest one (the blocks below are full).
+		MemBlock mem = (mCurrentOverflow == nullptr) ? Base::Alloc(inSize) : mCurrentOverflow->mArena.Alloc(inSize);
+
+		if (mem != nullptr) [[likely]]
+			return mem;
+
+		return AllocOverflow(inSize);
+	}
+
+	// Free memory. inMemory should be the last allocation in its block, or the arena should support enough out-of-order frees.
+	void Free(MemBlock inMemory)
+	{
+		if (Base::Owns(inMemory.mPtr)) [[likely]]
+		{
+			Base::Free(inMemory);
+			return;
+		}
+
+		// Note: Blocks emptied by frees are not released here, a Savepoint may still point at them.
+		// They are reused by later allocations and released on rewind.
+		Details::TempOverflowBlock* block = FindOverflowBlock(inMemory.mPtr);
+		gAssert(block != nullptr); // Not allocated from this arena.
+		block->mArena.Free(inMemory);
+	}
+
+	// Try resizing ioMemory inside the block that contains it. Return true on success.
+	bool TryRealloc(MemBlock& ioMemory, int inNewSize)
+	{
+		if (Base::Owns(ioMemory.mPtr)) [[likely]]
+			return Base::TryRealloc(ioMemory, inNewSize);
+
+		Details::TempOverflowBlock* block = FindOverflowBlock(ioMemory.mPtr);
+		gAssert(block != nullptr); // Not allocated from this arena.
+		return block->mArena.TryRealloc(ioMemory, inNewSize);
+	}
+
+	// Return true if inMemoryPtr is inside this arena (initial block or any overflow block).
+	bool Owns(const void* inMemoryPtr) const
+	{
+		if (Base::Owns(inMemoryPtr)) [[likely]]
+			return true;
+
+		return FindOverflowBlock(inMemoryPtr) != nullptr;
+	}
+
+	// Return true if inMemory is the last allocation in the block that contains it (ie. can potentially be resized in place).
+	bool IsLastAlloc(MemBlock inMemory) const
+	{
+		if (Base::Owns(inMemory.mPtr)) [[likely]]
+			return Base::IsLastAlloc(inMemory);
+
+		Details::TempOverflowBlock* block = FindOverflowBlock(inMemory.mPtr);
+		gAssert(block != nullptr); // Not allocated from this arena.
+		return block->mArena.IsLastAlloc(inMemory);
+	}
+
+	// Return the amount of memory currently allocated, across all blocks.
+	int GetAllocatedSize() const
+	{
+		int size = Base::GetAllocatedSize();
+
+		for (const Details::TempOverflowBlock* block = mCurrentOverflow; block != nullptr; block = block->mPrev)
+			size += block->mArena.GetAllocatedSize();
+
+		return size;
+	}
+
+	// Capture the current position, to Rewind to later.
+	Savepoint GetSavepoint() const
+	{
+		if (mCurrentOverflow == nullptr) [[likely]]
+			return { nullptr, Base::GetAllocatedSize() };
+
+		return { mCurrentOverflow, mCurrentOverflow->mArena.GetAllocatedSize() };
+	}
+
+	// Rewind the arena to a previously captured Savepoint, dropping everything allocated since and
+	// releasing the overflow blocks that were chained since. The caller is responsible for making
+	// sure none of it is still referenced.
+	void Rewind(Savepoint inSavepoint)
+	{
+		if (mCurrentOverflow != inSavepoint.mOverflowBlock) [[unlikely]]
+			FreeOverflowBlocks(inSavepoint.mOverflowBlock);
+
+		if (mCurrentOverflow != nullptr) [[unlikely]]
+			mCurrentOverflow->mArena.Rewind(inSavepoint.mAllocatedSize);
+		else
+			Base::Rewind(inSavepoint.mAllocatedSize);
+	}
+
+private:
+	no_inline MemBlock AllocOverflow(int inSize);
+	no_inline void     FreeOverflowBlocks(Details::TempOverflowBlock* inKeepBlock);
+
+	Details::TempOverflowBlock* FindOverflowBlock(const void* inMemoryPtr) const
+	{
+		// The chain is short: overflowing is rare and blocks are arena-sized.
+		for (Details::TempOverflowBlock* block = mCurrentOverflow; block != nullptr; block = block->mPrev)
+			if (block->mArena.Owns(inMemoryPtr))
+				return block;
+
+		return nullptr;
+	}
+
+	Details::TempOverflowBlock* mCurrentOverflow = nullptr; // Newest overflow block, or nullptr if the initial block hasn't run out.
+};
+
 inline thread_local TempMemArena gTempMemArena;
 
 
+// Scope object that captures the temp memory arena's state and rewinds it on destruction.
+// Everything allocated from temp memory inside the scope must be dead by then; this lets
+// frame-style code allocate out of order freely and bulk-reset instead of leaking arena space
+// through the pending-free list. Overflow blocks chained inside the scope are released as well.
+struct TempMemScope : NoCopy
+{
+	TempMemScope() : mSavepoint(gTempMemArena.GetSavepoint()) {}
+	~TempMemScope() { gTempMemArena.Rewind(mSavepoint); }
+
+private:
+	TempMemArena::Savepoint mSavepoint;
+};
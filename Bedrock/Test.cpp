@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/Test.h>
+#include <Bedrock/Atomic.h>
 #include <Bedrock/Debug.h>
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Thread.h>
 #include <Bedrock/Vector.h>
 #include <Bedrock/StringView.h>
 #include <Bedrock/Trace.h>
@@ -9,8 +12,9 @@
 
 struct Test
 {
-	const char*  mName;
-	TestFunction mFunction = nullptr;
+	const char*   mName;
+	TestFunction  mFunction = nullptr;
+	ETestSchedule mSchedule = ETestSchedule::Parallel;
 };
 
 static Vector<Test>& sGetAllTests()
@@ -21,11 +25,11 @@ static Vector<Test>& sGetAllTests()
 }
 
 
-void gRegisterTest(const char* inName, TestFunction inFunction)
+void gRegisterTest(const char* inName, TestFunction inFunction, ETestSchedule inSchedule)
 {
 	gAssert(inName != nullptr && inName[0] != 0);
 
-	sGetAllTests().PushBack({ inName, inFunction });
+	sGetAllTests().PushBack({ inName, inFunction, inSchedule });
 }
 
 
@@ -42,6 +46,43 @@ bool gIsRunningTest()
 }
 
 
+// Result of one test, for aggregated reporting.
+struct TestRun
+{
+	bool   mSuccess      = false;
+	double mMilliseconds = 0.0;
+};
+
+// Run one test on the current thread and fill in its result.
+static void sRunOneTest(const Test& inTest, TestRun& outRun)
+{
+	sCurrentTestName       = inTest.mName;
+	sCurrentTestSuccess    = true;
+
+	sCurrentTestAllocCount     = 0;
+	sCurrentTestAllocTotalSize = 0;
+
+	Timer timer;
+
+	inTest.mFunction();
+
+	if (sCurrentTestAllocCount != 0 || sCurrentTestAllocTotalSize != 0)
+	{
+		gTrace(R"(Test "%s": memory leaks detected: %d allocations (%lld bytes))", inTest.mName, sCurrentTestAllocCount, sCurrentTestAllocTotalSize);
+		sCurrentTestSuccess = false;
+
+		// If a debugger is attached, break to make sure it's noticed.
+		if (gIsDebuggerAttached())
+			BREAKPOINT;
+	}
+
+	outRun.mSuccess      = sCurrentTestSuccess;
+	outRun.mMilliseconds = gTicksToMilliseconds(timer.GetTicks());
+
+	sCurrentTestName = "";
+}
+
+
 TestResult gRunTests()
 {
 	gTrace("Running all tests.");
@@ -49,34 +90,89 @@ TestResult gRunTests()
 
 	for (const Test& test : sGetAllTests())
 	{
-		sCurrentTestName       = test.mName;
-		sCurrentTestSuccess    = true;
+		gTrace(R"(Test "%s" starting.)", test.mName);
 
-		sCurrentTestAllocCount     = 0;
-		sCurrentTestAllocTotalSize = 0;
+		TestRun run;
+		sRunOneTest(test, run);
 
-		gTrace(R"(Test "%s" starting.)", test.mName);
-		Timer timer;
+		gTrace(R"(Test "%s" finished: %s (%.2f ms))", 
+			test.mName, 
+			run.mSuccess ? "Success" : "Failure",
+			run.mMilliseconds);
+
+		all_success = all_success && run.mSuccess;
+	}
 
-		test.mFunction();
+	return all_success ? TestResult::Success : TestResult::Failure;
+}
 
-		if (sCurrentTestAllocCount != 0 || sCurrentTestAllocTotalSize != 0)
-		{
-			gTrace("Memory leaks detected: %d allocations (%lld bytes)", sCurrentTestAllocCount, sCurrentTestAllocTotalSize);
-			sCurrentTestSuccess = false;
 
-			// If a debugger is attached, break to make sure it's noticed.
-			if (gIsDebuggerAttached())
-				BREAKPOINT;
-		}
+TestResult gRunTestsParallel(int inNumThreads)
+{
+	Span<const Test> tests = sGetAllTests();
 
-		gTrace(R"(Test "%s" finished: %s (%.2f ms))", 
-			test.mName, 
-			sCurrentTestSuccess ? "Success" : "Failure",
-			gTicksToMilliseconds(timer.GetTicks()));
+	if (inNumThreads <= 0)
+		inNumThreads = gThreadHardwareConcurrency();
+	inNumThreads = gMin(inNumThreads, tests.Size());
+
+	if (inNumThreads <= 1)
+		return gRunTests();
+
+	gTrace("Running all tests on %d threads.", inNumThreads);
+
+	// Workers grab the next test off a shared counter; results land in per-test slots so the
+	// summary below is in registration order no matter how the tests were scheduled.
+	Vector<TestRun> runs;
+	runs.Resize(tests.Size());
+
+	struct Context
+	{
+		Span<const Test> mTests;
+		Span<TestRun>    mRuns;
+		AtomicInt32      mNextTest = 0;
+	};
+	Context context = { tests, runs };
 
-		all_success = all_success && sCurrentTestSuccess;
-		sCurrentTestName = "";
+	// Thread is not movable so it can't go in a Vector, allocate an array instead.
+	MemBlock thread_memory = gMemAlloc(inNumThreads * sizeof(Thread));
+	Thread*  threads       = (Thread*)thread_memory.mPtr;
+
+	for (int i = 0; i < inNumThreads; i++)
+	{
+		gPlacementNew(threads[i]);
+		threads[i].Create({ .mName = "TestWorker" }, [&context](Thread&) {
+			int index;
+			while ((index = context.mNextTest.Add(1)) < context.mTests.Size())
+			{
+				const Test& test = context.mTests[index];
+
+				// Serial tests run after the workers have joined.
+				if (test.mSchedule == ETestSchedule::Serial)
+					continue;
+
+				sRunOneTest(test, context.mRuns[index]);
+			}
+		});
+	}
+
+	for (int i = 0; i < inNumThreads; i++)
+	{
+		threads[i].Join();
+		threads[i].~Thread();
+	}
+	gMemFree(thread_memory);
+
+	// Serial phase: tests that mutate process-global state run one at a time.
+	for (int i = 0; i < tests.Size(); i++)
+		if (tests[i].mSchedule == ETestSchedule::Serial)
+			sRunOneTest(tests[i], runs[i]);
+
+	// Aggregated report, in registration order.
+	bool all_success = true;
+	for (int i = 0; i < tests.Size(); i++)
+	{
+		gTrace(R"(Test "%s": %s (%.2f ms))", tests[i].mName, runs[i].mSuccess ? "Success" : "Failure", runs[i].mMilliseconds);
+		all_success = all_success && runs[i].mSuccess;
 	}
 
 	return all_success ? TestResult::Success : TestResult::Failure;
@@ -25,13 +25,26 @@ enum class TestResult
 	Failure
 };
 
+// How gRunTestsParallel is allowed to schedule a test.
+enum class ETestSchedule : uint8
+{
+	Parallel,	// Default: may run concurrently with other tests.
+	Serial,		// Mutates process-global state; runs alone, after the parallel workers have joined.
+};
+
 
 // Register a test. Called automatically by REGISTER_TEST.
-void gRegisterTest(const char* inName, TestFunction inFunction); 
+void gRegisterTest(const char* inName, TestFunction inFunction, ETestSchedule inSchedule = ETestSchedule::Parallel);
 
 // Run all registered tests.
 TestResult gRunTests();
 
+// Run all registered tests in parallel on inNumThreads worker threads (0 means one per core).
+// Tests must not depend on each other; each worker gets its own temp memory and leak tracking.
+// Tests registered with REGISTER_TEST_SERIAL run one at a time once the workers have joined.
+// Failures are traced as they happen, and a summary in registration order is traced at the end.
+TestResult gRunTestsParallel(int inNumThreads = 0);
+
 // Return true if the current thread is running a test.
 bool gIsRunningTest();											 
 
@@ -45,16 +58,18 @@ void gRegisterFree(MemBlock inMemory);
 namespace Details
 {
 	struct TestDummy {
-		const char* mName;
-		consteval TestDummy(const char* inName)
+		const char*   mName;
+		ETestSchedule mSchedule;
+		consteval TestDummy(const char* inName, ETestSchedule inSchedule = ETestSchedule::Parallel)
 		{
 			gAssert(inName != nullptr && inName[0] != 0);
-			mName = inName;
+			mName     = inName;
+			mSchedule = inSchedule;
 		}
 	};
 
-	struct TestRegisterer { TestRegisterer(const char* inName, TestFunction inFunction) { IF_TESTS_ENABLED(gRegisterTest(inName, inFunction)); } };
-	inline TestRegisterer operator*(TestDummy inDummy, TestFunction inFunction) { return { inDummy.mName, inFunction }; }
+	struct TestRegisterer { TestRegisterer(const char* inName, TestFunction inFunction, ETestSchedule inSchedule) { IF_TESTS_ENABLED(gRegisterTest(inName, inFunction, inSchedule)); } };
+	inline TestRegisterer operator*(TestDummy inDummy, TestFunction inFunction) { return { inDummy.mName, inFunction, inDummy.mSchedule }; }
 }
 
 // Register a test.
@@ -67,6 +82,10 @@ namespace Details
 // };
 #define REGISTER_TEST(name) static auto TOKEN_PASTE(test_register, __LINE__) = Details::TestDummy{ name } *[]()
 
+// Register a test that cannot run concurrently with other tests because it mutates process-global
+// state (eg. the default TaskScheduler, the trace callback, the memory profiler).
+#define REGISTER_TEST_SERIAL(name) static auto TOKEN_PASTE(test_register, __LINE__) = Details::TestDummy{ name, ETestSchedule::Serial } *[]()
+
 // Check that a condition is true. Fail the current test otherwise.
 #define TEST_TRUE(code) do { if (!(code)) gFailTest("TEST_TRUE", #code, Details::ConstevalGetFileNamePart(__FILE__), __LINE__); } while(0)
 
@@ -63,6 +63,14 @@ void Thread::Create(const ThreadConfig& inConfig, Function<void(Thread&)>&& ioEn
 	}
 	SetThreadPriority(mOSThread, priority);
 
+	// Set the affinity mask and ideal processor while the thread is still suspended,
+	// so it never runs on the wrong core.
+	if (inConfig.mAffinityMask != 0)
+		SetThreadAffinityMask(mOSThread, inConfig.mAffinityMask);
+
+	if (inConfig.mIdealProcessor >= 0)
+		SetThreadIdealProcessor(mOSThread, inConfig.mIdealProcessor);
+
 	// Start the thread.
 	ResumeThread(mOSThread);
 }
@@ -106,6 +114,20 @@ int gThreadHardwareConcurrency()
 }
 
 
+// Number of NUMA nodes in the system (1 on single-socket machines).
+int gGetNumaNodeCount()
+{
+	static const int number_of_nodes = [] {
+		ULONG highest_node = 0;
+		if (!GetNumaHighestNodeNumber(&highest_node))
+			return 1;
+		return (int)highest_node + 1;
+	}();
+
+	return number_of_nodes;
+}
+
+
 // Yield the processor to other threads that are ready to run.
 void gYieldThread()
 {
@@ -143,4 +165,27 @@ REGISTER_TEST("Thread")
 	TEST_TRUE(set_by_thread);
 
 	TEST_TRUE(gThreadHardwareConcurrency() >= 1);
+	TEST_TRUE(gGetNumaNodeCount() >= 1);
+};
+
+
+REGISTER_TEST("ThreadAffinity")
+{
+	Thread thread;
+
+	uint32 processor = (uint32)-1;
+
+	thread.Create(
+		{
+			.mAffinityMask   = 1, // Logical core 0 only.
+			.mIdealProcessor = 0,
+		},
+		[&processor](Thread&)
+		{
+			processor = GetCurrentProcessorNumber();
+		});
+
+	thread.Join();
+
+	TEST_TRUE(processor == 0);
 };
\ No newline at end of file
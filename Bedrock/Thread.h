@@ -24,10 +24,12 @@ enum class EThreadPriority : int8
 
 struct ThreadConfig
 {
-	String          mName        = "";      // The thread name.
-	int             mStackSize   = 128_KiB; // The stack size of the thread.
-	int             mTempMemSize = 128_KiB; // Initialize a temp memory of that size of the thread. Can be 0.
-	EThreadPriority mPriority    = EThreadPriority::Normal; // The priority of the thread.
+	String          mName           = "";      // The thread name.
+	int             mStackSize      = 128_KiB; // The stack size of the thread.
+	int             mTempMemSize    = 128_KiB; // Initialize a temp memory of that size of the thread. Can be 0.
+	EThreadPriority mPriority       = EThreadPriority::Normal; // The priority of the thread.
+	uint64          mAffinityMask   = 0;       // Restrict the thread to these logical cores (one bit per core). 0 means run anywhere.
+	int             mIdealProcessor = -1;      // Preferred logical core, a scheduling hint (unlike the hard affinity mask). -1 means let the OS choose.
 };
 
 
@@ -60,8 +62,12 @@ private:
 
 
 // Yield the processor to other threads that are ready to run.
-void gThreadYield();
+void gYieldThread();
 
 // Number of threads that can run concurrently.
 // Equivalent to the number of CPU cores (incuding hyperthreading logical cores).
-int gThreadHardwareConcurrency();
\ No newline at end of file
+int gThreadHardwareConcurrency();
+
+// Number of NUMA nodes in the system (1 on single-socket machines).
+// Useful together with ThreadConfig::mAffinityMask and gVMemReserveNuma to keep threads close to their memory.
+int gGetNumaNodeCount();
\ No newline at end of file
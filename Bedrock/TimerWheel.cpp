@@ -0,0 +1,378 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/TimerWheel.h>
+
+#include <Bedrock/PlacementNew.h>
+#include <Bedrock/Random.h>
+#include <Bedrock/TaskScheduler.h>
+#include <Bedrock/Test.h>
+
+
+TimerWheel::TimerWheel(const TimerWheelConfig& inConfig)
+{
+	mTickDurationNS = (int64)inConfig.mTickDuration;
+	gAssert(mTickDurationNS > 0);
+
+	mScheduler = inConfig.mScheduler;
+}
+
+
+TimerWheel::~TimerWheel()
+{
+	// Destroy the pending callbacks without calling them.
+	for (Level& level : mLevels)
+		for (Details::TimerNode* node : level.mSlots)
+			for (; node != nullptr; node = node->mNext)
+				node->mCallback = {};
+
+	for (MemBlock chunk : mNodeChunks)
+		gMemFree(chunk);
+}
+
+
+TimerHandle TimerWheel::Schedule(NanoSeconds inDelay, Function<void()>&& ioCallback)
+{
+	gAssert((int64)inDelay >= 0);
+
+	// Round up to the next tick so a timer never fires before its deadline,
+	// with a minimum of one tick (a zero delay fires on the next Update).
+	int64 delay_ticks = gMax(((int64)inDelay + mTickDurationNS - 1) / mTickDurationNS, (int64)1);
+	gAssert(delay_ticks < cMaxDelay); // Deadline too far away for the wheel range.
+
+	Details::TimerNode* node = AllocNode();
+	node->mCallback   = gMove(ioCallback);
+	node->mExpiryTick = mCurrentTick + delay_ticks;
+
+	InsertNode(node);
+	mNumPending++;
+
+	return { node, node->mGeneration };
+}
+
+
+bool TimerWheel::Cancel(TimerHandle inHandle)
+{
+	// A stale generation means the timer already fired or was cancelled (and the node got reused).
+	if (!inHandle.IsValid() || inHandle.mGeneration != inHandle.mNode->mGeneration)
+		return false;
+
+	Details::TimerNode* node = inHandle.mNode;
+
+	// Unlink from its slot list.
+	*node->mPrevNext = node->mNext;
+	if (node->mNext != nullptr)
+		node->mNext->mPrevNext = node->mPrevNext;
+
+	FreeNode(node);
+	mNumPending--;
+	return true;
+}
+
+
+int TimerWheel::Update(NanoSeconds inElapsed)
+{
+	gAssert((int64)inElapsed >= 0);
+
+	mNanoRemainder += (int64)inElapsed;
+	int64 num_ticks = mNanoRemainder / mTickDurationNS;
+	mNanoRemainder -= num_ticks * mTickDurationNS;
+
+	int64 target_tick = mCurrentTick + num_ticks;
+	int   num_fired   = 0;
+
+	while (mCurrentTick < target_tick)
+	{
+		if (mNumPending == 0)
+		{
+			// Nothing scheduled, jump straight to the target.
+			mCurrentTick = target_tick;
+			break;
+		}
+
+		mCurrentTick++;
+		int slot = (int)(mCurrentTick & cSlotMask);
+
+		// Entering a new revolution of the first wheel, pull the timers due during it down from the upper levels.
+		if (slot == 0)
+			Cascade();
+
+		if (mLevels[0].mOccupiedMask & (1ull << slot))
+		{
+			num_fired += ExpireSlot(slot);
+		}
+		else if (slot != cSlotMask)
+		{
+			// Fast-forward over the empty slots, up to the next occupied one, the end of the
+			// revolution (where a cascade is due) or the target tick, whichever comes first.
+			uint64 mask_after = mLevels[0].mOccupiedMask >> (slot + 1);
+			int64  num_empty  = (mask_after != 0) ? gCountTrailingZeros64(mask_after) : (cSlotMask - slot);
+			mCurrentTick      = gMin(mCurrentTick + num_empty, target_tick);
+		}
+	}
+
+	return num_fired;
+}
+
+
+Details::TimerNode* TimerWheel::AllocNode()
+{
+	if (mFreeNodes == nullptr)
+	{
+		// Allocate a new chunk of timer nodes and add them to the free list.
+		MemBlock chunk = gMemAlloc(cNodesPerChunk * sizeof(Details::TimerNode));
+		mNodeChunks.PushBack(chunk);
+
+		auto nodes = (Details::TimerNode*)chunk.mPtr;
+		for (int i = 0; i < cNodesPerChunk; i++)
+		{
+			gPlacementNew(nodes[i]);
+			nodes[i].mNext = mFreeNodes;
+			mFreeNodes     = &nodes[i];
+		}
+	}
+
+	Details::TimerNode* node = mFreeNodes;
+	mFreeNodes  = node->mNext;
+	node->mNext = nullptr;
+	return node;
+}
+
+
+void TimerWheel::FreeNode(Details::TimerNode* ioNode)
+{
+	ioNode->mCallback = {};
+	ioNode->mGeneration++; // Invalidate any outstanding TimerHandle.
+
+	ioNode->mNext = mFreeNodes;
+	mFreeNodes    = ioNode;
+}
+
+
+void TimerWheel::InsertNode(Details::TimerNode* ioNode)
+{
+	int64 delta = ioNode->mExpiryTick - mCurrentTick;
+	gAssert(delta >= 0 && delta < cMaxDelay);
+
+	// Find the first level coarse enough that the deadline fits inside one revolution.
+	int   level = 0;
+	int64 span  = cNumSlots;
+	while (delta >= span)
+	{
+		level++;
+		span <<= cSlotShift;
+	}
+
+	int                  slot = (int)((ioNode->mExpiryTick >> (cSlotShift * level)) & cSlotMask);
+	Details::TimerNode*& head = mLevels[level].mSlots[slot];
+
+	ioNode->mNext     = head;
+	ioNode->mPrevNext = &head;
+	if (head != nullptr)
+		head->mPrevNext = &ioNode->mNext;
+	head = ioNode;
+
+	mLevels[level].mOccupiedMask |= 1ull << slot;
+}
+
+
+int TimerWheel::ExpireSlot(int inSlot)
+{
+	// Detach the whole list first: callbacks may schedule new timers into this same slot.
+	Details::TimerNode* node = mLevels[0].mSlots[inSlot];
+	mLevels[0].mSlots[inSlot] = nullptr;
+	mLevels[0].mOccupiedMask &= ~(1ull << inSlot);
+
+	// Invalidate every detached node before calling any callback: a callback may Cancel another
+	// timer due on this same tick, and that Cancel must fail the generation check instead of
+	// unlinking from a list the loop below is still walking.
+	int num_fired = 0;
+	for (Details::TimerNode* invalidate = node; invalidate != nullptr; invalidate = invalidate->mNext)
+	{
+		gAssert(invalidate->mExpiryTick == mCurrentTick);
+		invalidate->mGeneration++;
+		mNumPending--;
+		num_fired++;
+	}
+
+	// Now fire the callbacks. The nodes go back to the free list one by one, so a callback that
+	// schedules a new timer may reuse the node that just fired, but never one still in this list.
+	while (node != nullptr)
+	{
+		Details::TimerNode* next = node->mNext;
+
+		Function<void()> callback = gMove(node->mCallback);
+		FreeNode(node);
+
+		if (mScheduler != nullptr)
+			mScheduler->Submit(gMove(callback));
+		else
+			callback();
+
+		node = next;
+	}
+
+	return num_fired;
+}
+
+
+void TimerWheel::Cascade()
+{
+	for (int level = 1; level < cNumLevels; level++)
+	{
+		int slot = (int)((mCurrentTick >> (cSlotShift * level)) & cSlotMask);
+
+		// Detach the slot and re-insert its timers; their deadline is near now, so they land in a lower level.
+		Details::TimerNode* node = mLevels[level].mSlots[slot];
+		mLevels[level].mSlots[slot] = nullptr;
+		mLevels[level].mOccupiedMask &= ~(1ull << slot);
+
+		while (node != nullptr)
+		{
+			Details::TimerNode* next = node->mNext;
+			InsertNode(node);
+			node = next;
+		}
+
+		// The upper levels only advance one slot when this one wraps around.
+		if (slot != 0)
+			break;
+	}
+}
+
+
+REGISTER_TEST("TimerWheel")
+{
+	// A 1 ns tick makes one Update(1_NS) advance exactly one tick.
+	TimerWheel wheel({ .mTickDuration = 1_NS });
+	TEST_TRUE(wheel.GetNumPendingTimers() == 0);
+
+	// A zero delay fires on the next Update.
+	int num_calls = 0;
+	wheel.Schedule(0_NS, [&num_calls] { num_calls++; });
+	TEST_TRUE(wheel.GetNumPendingTimers() == 1);
+	TEST_TRUE(wheel.Update(1_NS) == 1);
+	TEST_TRUE(num_calls == 1);
+	TEST_TRUE(wheel.GetNumPendingTimers() == 0);
+
+	// Timers fire exactly at their deadline, including across cascade boundaries
+	// (delay 100 goes to level 1, delay 5000 to level 2).
+	int64 fired_at[3] = {};
+	int64 now         = 1;
+	wheel.Schedule((NanoSeconds)30,   [&] { fired_at[0] = now; });
+	wheel.Schedule((NanoSeconds)100,  [&] { fired_at[1] = now; });
+	wheel.Schedule((NanoSeconds)5000, [&] { fired_at[2] = now; });
+
+	for (int i = 0; i < 6000; i++)
+	{
+		now++;
+		wheel.Update(1_NS);
+	}
+	TEST_TRUE(fired_at[0] == 1 + 30);
+	TEST_TRUE(fired_at[1] == 1 + 100);
+	TEST_TRUE(fired_at[2] == 1 + 5000);
+
+	// Cancelling works once; after the timer fired it returns false.
+	num_calls = 0;
+	TimerHandle cancelled = wheel.Schedule((NanoSeconds)10, [&num_calls] { num_calls++; });
+	TimerHandle fired     = wheel.Schedule((NanoSeconds)10, [&num_calls] { num_calls++; });
+	TEST_TRUE(wheel.Cancel(cancelled));
+	TEST_FALSE(wheel.Cancel(cancelled));
+	TEST_TRUE(wheel.Update((NanoSeconds)20) == 1);
+	TEST_TRUE(num_calls == 1);
+	TEST_FALSE(wheel.Cancel(fired));
+	TEST_FALSE(wheel.Cancel({}));
+
+	// A single large Update covers many ticks at once.
+	num_calls = 0;
+	wheel.Schedule((NanoSeconds)123456, [&num_calls] { num_calls++; });
+	TEST_TRUE(wheel.Update((NanoSeconds)200000) == 1);
+	TEST_TRUE(num_calls == 1);
+
+	// Callbacks can re-schedule into the wheel being updated.
+	num_calls = 0;
+	wheel.Schedule((NanoSeconds)5, [&wheel, &num_calls] {
+		num_calls++;
+		wheel.Schedule((NanoSeconds)5, [&num_calls] { num_calls++; });
+	});
+	wheel.Update((NanoSeconds)100);
+	TEST_TRUE(num_calls == 2);
+	TEST_TRUE(wheel.GetNumPendingTimers() == 0);
+
+	// Cancelling a timer due on the same tick from inside a callback is a no-op: it already counts
+	// as fired and its callback still runs. Note: slot lists are LIFO, so the canceller is
+	// scheduled last to make it fire first, while the cancelled timer is still waiting its turn.
+	num_calls = 0;
+	TimerHandle same_tick = wheel.Schedule((NanoSeconds)5, [&num_calls] { num_calls++; });
+	wheel.Schedule((NanoSeconds)5, [&wheel, same_tick, &num_calls] {
+		num_calls++;
+		TEST_FALSE(wheel.Cancel(same_tick));
+	});
+	TEST_TRUE(wheel.Update((NanoSeconds)10) == 2);
+	TEST_TRUE(num_calls == 2);
+	TEST_TRUE(wheel.GetNumPendingTimers() == 0);
+};
+
+
+REGISTER_TEST("TimerWheel Stress")
+{
+	TimerWheel wheel({ .mTickDuration = 1_NS });
+
+	// Many timers with random delays spanning several levels; each checks it fires during the
+	// Update covering its deadline.
+	struct Clock
+	{
+		int64 mPrevNow   = 0;
+		int64 mNow       = 0;
+		int   mNumMissed = 0;
+		int   mNumFired  = 0;
+	};
+
+	constexpr int cNumTimers = 5000;
+	Clock         clock;
+	int           rand_seed = 42;
+
+	for (int i = 0; i < cNumTimers; i++)
+	{
+		rand_seed = gRand32(rand_seed);
+		int64 delay    = (uint32)rand_seed % 200000 + 1;
+		int64 deadline = clock.mNow + delay;
+
+		wheel.Schedule((NanoSeconds)delay, [&clock, deadline] {
+			if (deadline <= clock.mPrevNow || deadline > clock.mNow)
+				clock.mNumMissed++;
+			clock.mNumFired++;
+		});
+	}
+	TEST_TRUE(wheel.GetNumPendingTimers() == cNumTimers);
+
+	// Advance in uneven steps until everything fired.
+	int step_seed = 1;
+	while (wheel.GetNumPendingTimers() > 0)
+	{
+		step_seed = gRand32(step_seed);
+		int64 step     = (uint32)step_seed % 700 + 1;
+		clock.mPrevNow = clock.mNow;
+		clock.mNow += step;
+		wheel.Update((NanoSeconds)step);
+	}
+
+	TEST_TRUE(clock.mNumFired == cNumTimers);
+	TEST_TRUE(clock.mNumMissed == 0);
+};
+
+
+REGISTER_TEST("TimerWheel Fractional Ticks")
+{
+	// With a 1 ms tick, sub-tick updates accumulate and deadlines round up to the next tick.
+	TimerWheel wheel; // Default config, 1_MS ticks.
+
+	int num_calls = 0;
+	wheel.Schedule(1.5_MS, [&num_calls] { num_calls++; }); // Rounds up to 2 ticks.
+
+	TEST_TRUE(wheel.Update(0.9_MS) == 0);
+	TEST_TRUE(wheel.Update(0.9_MS) == 0); // 1.8 ms elapsed, 1 tick.
+	TEST_TRUE(wheel.Update(0.9_MS) == 1); // 2.7 ms elapsed, 2 ticks.
+	TEST_TRUE(num_calls == 1);
+
+	// Pending timers (and their callbacks) are freed by the destructor (leak detection will tell).
+	wheel.Schedule(10_S, [] {});
+};
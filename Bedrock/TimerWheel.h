@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Function.h>
+#include <Bedrock/Memory.h>
+#include <Bedrock/Time.h>
+#include <Bedrock/Vector.h>
+
+
+struct TaskScheduler;
+struct TimerWheel;
+
+namespace Details
+{
+	// A scheduled timeout as stored internally by the wheel.
+	struct TimerNode
+	{
+		Function<void()> mCallback;
+		int64            mExpiryTick = 0;
+		TimerNode*       mNext       = nullptr;
+		TimerNode**      mPrevNext   = nullptr; // Points at the pointer pointing at this node (slot head or previous mNext), for O(1) unlink.
+		uint32           mGeneration = 0;       // Incremented every time the node is freed, detects stale TimerHandles.
+	};
+}
+
+
+// Handle returned by TimerWheel::Schedule, used to cancel the timeout.
+// Safe to keep around after the timer fired: cancelling then is a no-op.
+struct TimerHandle
+{
+	TimerHandle() = default;
+
+	bool IsValid() const { return mNode != nullptr; }
+
+private:
+	friend struct TimerWheel;
+	TimerHandle(Details::TimerNode* inNode, uint32 inGeneration) : mNode(inNode), mGeneration(inGeneration) {}
+
+	Details::TimerNode* mNode       = nullptr;
+	uint32              mGeneration = 0;
+};
+
+
+struct TimerWheelConfig
+{
+	NanoSeconds    mTickDuration = 1_MS;    // Resolution of the wheel. Deadlines are rounded up to the next tick.
+	TaskScheduler* mScheduler    = nullptr; // If set, expired callbacks are submitted as tasks instead of being called inside Update.
+};
+
+
+// Hierarchical timer wheel for large numbers of outstanding timeouts.
+// Schedule and Cancel are O(1): deadlines hash into the slot of a wheel level based on how far
+// away they are, and each level is 64x coarser than the one below (level 0 is one tick per slot).
+// Update advances the wheel by the elapsed time and fires the expired timers in batches; timers
+// only move between levels when a level wraps around, so the common case touches one slot list.
+// Not thread-safe; the expected use is one wheel owned by the thread (or system) driving it.
+struct TimerWheel : NoCopy
+{
+	explicit TimerWheel(const TimerWheelConfig& inConfig = {});
+	~TimerWheel();
+
+	// Schedule ioCallback to fire once inDelay has elapsed (rounded up to the next tick).
+	// A zero delay fires on the next Update.
+	TimerHandle Schedule(NanoSeconds inDelay, Function<void()>&& ioCallback);
+
+	// Cancel a scheduled timer. Returns false if it already fired or was already cancelled.
+	bool Cancel(TimerHandle inHandle);
+
+	// Advance the wheel by inElapsed and fire the expired timers. Returns the number fired.
+	int Update(NanoSeconds inElapsed);
+
+	int GetNumPendingTimers() const { return mNumPending; }
+
+private:
+	static constexpr int   cNumLevels    = 6;             // Max delay is 64^6 ticks (over 2 years at the default 1 ms tick).
+	static constexpr int   cSlotShift    = 6;
+	static constexpr int   cNumSlots     = 64;            // Per level, so each level's occupancy fits in one uint64.
+	static constexpr int   cSlotMask     = cNumSlots - 1;
+	static constexpr int64 cMaxDelay     = 1ll << (cSlotShift * cNumLevels);
+	static constexpr int   cNodesPerChunk = 256;
+
+	struct Level
+	{
+		Details::TimerNode* mSlots[cNumSlots] = {};
+		uint64              mOccupiedMask     = 0; // One bit per slot, lets Update skip the empty ones.
+	};
+
+	Details::TimerNode* AllocNode();
+	void                FreeNode(Details::TimerNode* ioNode);
+	void                InsertNode(Details::TimerNode* ioNode); // Link the node into the right level/slot for its deadline.
+	int                 ExpireSlot(int inSlot);                 // Fire every timer in a level 0 slot.
+	void                Cascade();                              // Move the timers that are due soon down from the upper levels.
+
+	int64               mTickDurationNS = 0;
+	int64               mNanoRemainder  = 0;       // Elapsed time not yet converted into whole ticks.
+	int64               mCurrentTick    = 0;
+	int                 mNumPending     = 0;
+	TaskScheduler*      mScheduler      = nullptr;
+	Level               mLevels[cNumLevels];
+	Details::TimerNode* mFreeNodes      = nullptr; // Free list of timer nodes.
+	Vector<MemBlock>    mNodeChunks;               // Allocations backing the timer nodes.
+};
@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: MPL-2.0
 #include <Bedrock/Trace.h>
+#include <Bedrock/Mutex.h>
+#include <Bedrock/RingBuffer.h>
 #include <Bedrock/String.h>
 #include <Bedrock/StringFormat.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/Thread.h>
+#include <Bedrock/Vector.h>
 
 #include <stdarg.h>
 #include <stdio.h>
@@ -43,3 +48,187 @@ void gSetTraceCallback(TraceCallback inCallback)
 
 	sTraceCallback = inCallback;
 }
+
+
+namespace
+{
+
+// Per-thread ring buffer of queued traces, registered in a global list the background thread drains.
+struct TraceRing : NoCopy
+{
+	TraceRing();
+	~TraceRing();
+
+	RingBuffer<Details::TraceMessage, 256> mMessages;
+};
+
+
+struct AsyncTrace
+{
+	// Reserve upfront so that registering a ring usually doesn't allocate; thread_local
+	// registration can happen anywhere, including inside tests where allocations are leak-checked.
+	AsyncTrace() { mRings.Reserve(64); }
+
+	~AsyncTrace() { gStopAsyncTrace(); } // In case the user forgot, otherwise joining the thread would hang.
+
+	Mutex              mRingsMutex;      // Protects mRings; draining also happens under it so rings can unregister safely.
+	Vector<TraceRing*> mRings;
+	Thread             mThread;
+	AtomicBool         mEnabled    = false;
+	AtomicInt32        mNumPending = 0;   // Total number of queued messages, also what the background thread sleeps on.
+};
+
+AsyncTrace sAsyncTrace;
+thread_local TraceRing sTraceRing;
+
+
+TraceRing::TraceRing()
+{
+	LockGuard lock(sAsyncTrace.mRingsMutex);
+	sAsyncTrace.mRings.PushBack(this);
+}
+
+
+TraceRing::~TraceRing()
+{
+	// Give the background thread a chance to deliver what's left.
+	while (sAsyncTrace.mEnabled.Load() && !mMessages.Empty())
+		gYieldThread();
+
+	LockGuard lock(sAsyncTrace.mRingsMutex);
+
+	// Drop whatever is still queued. Only happens if async tracing was stopped at the same time
+	// this thread exited; popping is safe here because the background thread also only pops under
+	// the mutex.
+	Details::TraceMessage message;
+	int dropped = 0;
+	while (mMessages.TryPop(message))
+		dropped++;
+	if (dropped > 0)
+		sAsyncTrace.mNumPending.Sub(dropped);
+
+	for (int i = 0; i < sAsyncTrace.mRings.Size(); i++)
+	{
+		if (sAsyncTrace.mRings[i] == this)
+		{
+			sAsyncTrace.mRings.SwapErase(i);
+			break;
+		}
+	}
+}
+
+
+void sAsyncTraceLoop(Thread& ioThread)
+{
+	for (;;)
+	{
+		int pending = sAsyncTrace.mNumPending.Load();
+
+		if (pending <= 0)
+		{
+			if (ioThread.IsStopRequested())
+				break;
+
+			// Sleep until messages get queued (or we're woken up to stop).
+			Details::gWaitOnAddress(&sAsyncTrace.mNumPending, &pending, sizeof(pending));
+			continue;
+		}
+
+		// Deliver everything currently queued.
+		int delivered = 0;
+		{
+			LockGuard lock(sAsyncTrace.mRingsMutex);
+
+			for (TraceRing* ring : sAsyncTrace.mRings)
+			{
+				Details::TraceMessage message;
+				while (ring->mMessages.TryPop(message))
+				{
+					message.mUnpack(message);
+					delivered++;
+				}
+			}
+		}
+
+		if (delivered > 0)
+			sAsyncTrace.mNumPending.Sub(delivered);
+	}
+}
+
+} // namespace
+
+
+void Details::TraceQueueOrDeliver(const TraceMessage& inMessage)
+{
+	if (sAsyncTrace.mEnabled.Load(MemoryOrder::Relaxed)) [[unlikely]]
+	{
+		if (sTraceRing.mMessages.TryPush(inMessage)) [[likely]]
+		{
+			sAsyncTrace.mNumPending.Add(1);
+			gWakeOne(sAsyncTrace.mNumPending);
+			return;
+		}
+
+		// The ring is full, fall through and trace synchronously rather than dropping the message.
+	}
+
+	inMessage.mUnpack(inMessage);
+}
+
+
+void gStartAsyncTrace()
+{
+	gAssert(!sAsyncTrace.mEnabled.Load()); // Already started?
+
+	sAsyncTrace.mThread.Create({ .mName = "AsyncTrace" }, [](Thread& ioThread) { sAsyncTraceLoop(ioThread); });
+	sAsyncTrace.mEnabled.Store(true);
+}
+
+
+void gStopAsyncTrace()
+{
+	if (!sAsyncTrace.mEnabled.Load())
+		return;
+
+	// Make producers trace synchronously again, then let the background thread deliver what's
+	// queued before it stops (it only exits once the pending count reaches zero).
+	sAsyncTrace.mEnabled.Store(false);
+	sAsyncTrace.mThread.RequestStop();
+	gWakeAll(sAsyncTrace.mNumPending);
+	sAsyncTrace.mThread.Join();
+}
+
+
+REGISTER_TEST_SERIAL("AsyncTrace")
+{
+	static AtomicInt32 sNumTraces = 0;
+	sNumTraces.Store(0);
+
+	gSetTraceCallback([](StringView) { sNumTraces.Add(1); });
+	gStartAsyncTrace();
+
+	// Queue traces from several threads, with a few different argument types.
+	constexpr int cNumThreads      = 2;
+	constexpr int cTracesPerThread = 100;
+
+	Thread threads[cNumThreads];
+	for (Thread& thread : threads)
+	{
+		thread.Create({}, [](Thread&)
+		{
+			for (int i = 0; i < cTracesPerThread; i++)
+				gTrace("async trace test %d %s %g", i, "arg", 1.5);
+		});
+	}
+
+	for (Thread& thread : threads)
+		thread.Join();
+
+	gTrace("async trace test main");
+
+	// Stopping delivers everything that was queued.
+	gStopAsyncTrace();
+	TEST_TRUE(sNumTraces.Load() == cNumThreads * cTracesPerThread + 1);
+
+	gSetTraceCallback(nullptr);
+};
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <Bedrock/Core.h>
+#include <Bedrock/TypeTraits.h>
 
 // Trace/print a formatted string.
 // By default outputs to stdout, but that can be customized with gSetTraceCallback.
@@ -10,7 +11,7 @@
 	do                                     \
 	{                                      \
 		(void)sizeof(printf(__VA_ARGS__)); \
-		Details::Trace(__VA_ARGS__);       \
+		Details::TracePacked(__VA_ARGS__); \
 	} while (false)
 
 
@@ -18,6 +19,72 @@ namespace Details
 {
 	// Internal function doing the actual tracing.
 	void Trace(const char* inFormat, ...);
+
+	// One queued trace call: the format string pointer, the packed arguments, and a function that
+	// knows how to unpack them and call Trace.
+	struct TraceMessage
+	{
+		static constexpr int cMaxArgsSize = 48;
+
+		const char* mFormat;
+		void        (*mUnpack)(const TraceMessage&);
+		uint8       mArgs[cMaxArgsSize];
+	};
+
+	// Queue the message for the background thread if async tracing is enabled,
+	// otherwise unpack and trace it immediately.
+	void TraceQueueOrDeliver(const TraceMessage& inMessage);
+
+	// Recursively unpacks the arguments from a TraceMessage, then calls Trace with all of them.
+	template <typename... taArgs>
+	struct TraceUnpacker;
+
+	template <>
+	struct TraceUnpacker<>
+	{
+		template <typename... taUnpacked>
+		static void sUnpack(const TraceMessage& inMessage, int, const taUnpacked&... inUnpacked)
+		{
+			Trace(inMessage.mFormat, inUnpacked...);
+		}
+	};
+
+	template <typename taFirst, typename... taRest>
+	struct TraceUnpacker<taFirst, taRest...>
+	{
+		template <typename... taUnpacked>
+		static void sUnpack(const TraceMessage& inMessage, int inOffset, const taUnpacked&... inUnpacked)
+		{
+			taFirst value;
+			gMemCopy(&value, inMessage.mArgs + inOffset, sizeof(taFirst));
+			TraceUnpacker<taRest...>::sUnpack(inMessage, inOffset + (int)sizeof(taFirst), inUnpacked..., value);
+		}
+	};
+
+	// Internal function called by gTrace. Packs the arguments into a TraceMessage so that the
+	// formatting can happen later (and on another thread) when async tracing is enabled.
+	// Note: With async tracing, the format string and any %s argument are only read when the
+	// background thread formats the message, so they need to outlive the call (string literals do).
+	template <typename... taArgs>
+	void TracePacked(const char* inFormat, taArgs... inArgs)
+	{
+		static_assert((0 + ... + (int)sizeof(taArgs)) <= TraceMessage::cMaxArgsSize, "Too many arguments for one trace.");
+		static_assert((cIsTriviallyCopyable<taArgs> && ...));
+
+		TraceMessage message;
+		message.mFormat = inFormat;
+		message.mUnpack = [](const TraceMessage& inMessage) { TraceUnpacker<taArgs...>::sUnpack(inMessage, 0); };
+
+		int  offset   = 0;
+		auto pack_arg = [&message, &offset](const auto& inArg)
+		{
+			gMemCopy(message.mArgs + offset, &inArg, sizeof(inArg));
+			offset += (int)sizeof(inArg);
+		};
+		(pack_arg(inArgs), ...);
+
+		TraceQueueOrDeliver(message);
+	}
 }
 
 
@@ -27,7 +94,14 @@ using TraceCallback = void(*)(StringView inFormattedStr);
 // Set a callback for every trace. Can be used to do custom logging.
 void gSetTraceCallback(TraceCallback inCallback);
 
-// Printf forward declaration for the format validation hack above.
-extern "C" int __cdecl printf(const char* inFormat, ...);
+// Start a background thread that does the formatting and delivery of traces. While it is running,
+// gTrace only copies its arguments into a per-thread ring buffer, which keeps it to a few tens of
+// nanoseconds on the calling thread. If a ring buffer fills up, traces are delivered synchronously
+// rather than dropped.
+void gStartAsyncTrace();
 
+// Deliver all queued traces and stop the background thread. gTrace becomes fully synchronous again.
+void gStopAsyncTrace();
 
+// Printf forward declaration for the format validation hack above.
+extern "C" int __cdecl printf(const char* inFormat, ...);
@@ -39,9 +39,17 @@ template<class T> constexpr bool cHasUniqueObjectRepresentations = __has_unique_
 // Equivalent to std::is_trivially_default_constructible
 template <class T> constexpr bool cIsTriviallyDefaultConstructible = __is_trivially_constructible(T);
 
+// Equivalent to std::is_trivially_destructible
+template <class T> constexpr bool cIsTriviallyDestructible = __is_trivially_destructible(T);
+
 // Equivalent to std::is_trivially_copyable
 template <class T> constexpr bool cIsTriviallyCopyable = __is_trivially_copyable(T);
 
+// True if moving an object to a different address is equivalent to memcpy'ing its bytes (without destructing the source).
+// True by default for trivially copyable types. Types that own memory but contain no pointer into themselves
+// (eg. String, Vector) can opt in with a specialization; containers use it to relocate elements with a single memcpy.
+template <class T> constexpr bool cIsTriviallyRelocatable = cIsTriviallyCopyable<T>;
+
 // Equivalent to std::is_const
 namespace Details
 {
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/Unicode.h>
+
+#include <Bedrock/Test.h>
+
+
+bool gIsValidUtf8(StringView inString)
+{
+	const char* ptr = inString.Begin();
+	const char* end = inString.End();
+
+	while (ptr < end)
+	{
+#if BEDROCK_STRING_SSE2
+		// Skip ASCII 16 bytes at a time (see StringView.h for the SSE2 macro). Most real text is
+		// mostly ASCII, so this is where the time goes.
+		while (end - ptr >= 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)ptr);
+			if (_mm_movemask_epi8(block) != 0)
+				break; // A byte with the high bit set, drop to the scalar decoder.
+
+			ptr += 16;
+		}
+
+		if (ptr == end)
+			break;
+#endif
+
+		if (gUtf8Decode(ptr, end) == cInvalidCodePoint)
+			return false;
+	}
+
+	return true;
+}
+
+
+int gUtf8ToUtf16(StringView inUtf8, Span<wchar_t> outUtf16)
+{
+	const char* ptr     = inUtf8.Begin();
+	const char* end     = inUtf8.End();
+	wchar_t*    out     = outUtf16.Begin();
+	wchar_t*    out_end = outUtf16.End();
+
+	while (ptr < end)
+	{
+		uint32 code_point = gUtf8Decode(ptr, end);
+		if (code_point == cInvalidCodePoint)
+			return -1;
+
+		if (code_point < 0x10000)
+		{
+			if (out == out_end)
+				return -1;
+			*out++ = (wchar_t)code_point;
+		}
+		else
+		{
+			// Needs a surrogate pair.
+			if (out_end - out < 2)
+				return -1;
+			code_point -= 0x10000;
+			*out++ = (wchar_t)(0xD800 + (code_point >> 10));
+			*out++ = (wchar_t)(0xDC00 + (code_point & 0x3FF));
+		}
+	}
+
+	return (int)(out - outUtf16.Begin());
+}
+
+
+int gUtf16ToUtf8(Span<const wchar_t> inUtf16, Span<char> outUtf8)
+{
+	const wchar_t* ptr     = inUtf16.Begin();
+	const wchar_t* end     = inUtf16.End();
+	char*          out     = outUtf8.Begin();
+	char*          out_end = outUtf8.End();
+
+	while (ptr < end)
+	{
+		uint32 code_point = *ptr++;
+
+		if (code_point >= 0xD800 && code_point <= 0xDFFF)
+		{
+			// Must be a high surrogate followed by a low surrogate.
+			if (code_point >= 0xDC00 || ptr == end || *ptr < 0xDC00 || *ptr > 0xDFFF)
+				return -1;
+			code_point = 0x10000 + ((code_point - 0xD800) << 10) + (*ptr++ - 0xDC00);
+		}
+
+		int length = (code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+		if (out_end - out < length)
+			return -1;
+
+		switch (length)
+		{
+		case 1:
+			*out++ = (char)code_point;
+			break;
+		case 2:
+			*out++ = (char)(0xC0 | (code_point >> 6));
+			*out++ = (char)(0x80 | (code_point & 0x3F));
+			break;
+		case 3:
+			*out++ = (char)(0xE0 | (code_point >> 12));
+			*out++ = (char)(0x80 | ((code_point >> 6) & 0x3F));
+			*out++ = (char)(0x80 | (code_point & 0x3F));
+			break;
+		case 4:
+			*out++ = (char)(0xF0 | (code_point >> 18));
+			*out++ = (char)(0x80 | ((code_point >> 12) & 0x3F));
+			*out++ = (char)(0x80 | ((code_point >> 6) & 0x3F));
+			*out++ = (char)(0x80 | (code_point & 0x3F));
+			break;
+		}
+	}
+
+	return (int)(out - outUtf8.Begin());
+}
+
+
+REGISTER_TEST("Utf8Validation")
+{
+	TEST_TRUE(gIsValidUtf8(""));
+	TEST_TRUE(gIsValidUtf8("plain ascii"));
+	TEST_TRUE(gIsValidUtf8("caf\xC3\xA9"));                 // U+00E9, 2 bytes.
+	TEST_TRUE(gIsValidUtf8("\xE2\x82\xAC"));                // U+20AC (euro sign), 3 bytes.
+	TEST_TRUE(gIsValidUtf8("\xF0\x9F\x98\x80"));            // U+1F600 (emoji), 4 bytes.
+	TEST_TRUE(gIsValidUtf8("\xF4\x8F\xBF\xBF"));            // U+10FFFF, the last valid code point.
+
+	TEST_FALSE(gIsValidUtf8("\x80"));                       // Lone continuation byte.
+	TEST_FALSE(gIsValidUtf8("\xC3"));                       // Truncated sequence.
+	TEST_FALSE(gIsValidUtf8("\xC3\x28"));                   // Missing continuation byte.
+	TEST_FALSE(gIsValidUtf8("\xC0\xAF"));                   // Overlong encoding of '/'.
+	TEST_FALSE(gIsValidUtf8("\xE0\x80\x80"));               // Overlong encoding of U+0000.
+	TEST_FALSE(gIsValidUtf8("\xED\xA0\x80"));               // U+D800, surrogate.
+	TEST_FALSE(gIsValidUtf8("\xF4\x90\x80\x80"));           // U+110000, above the last code point.
+	TEST_FALSE(gIsValidUtf8("\xF8\x88\x80\x80\x80"));       // 5-byte sequences don't exist.
+
+	// Long enough to take the 16-bytes-at-a-time ASCII path, with the bad byte after it.
+	TEST_TRUE(gIsValidUtf8("a long mostly ascii string with an accent at the end: caf\xC3\xA9"));
+	TEST_FALSE(gIsValidUtf8("a long mostly ascii string with a bad byte at the end: \xFF"));
+};
+
+
+REGISTER_TEST("Utf8CodePoints")
+{
+	// "aé€😀" : 1, 2, 3 and 4-byte sequences.
+	StringView text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+
+	constexpr uint32 cExpected[] = { 'a', 0xE9, 0x20AC, 0x1F600 };
+
+	int num_code_points = 0;
+	for (uint32 code_point : gUtf8CodePoints(text))
+	{
+		TEST_TRUE(code_point == cExpected[num_code_points]);
+		num_code_points++;
+	}
+	TEST_TRUE(num_code_points == 4);
+
+	// Invalid bytes come out as one replacement character each, and iteration keeps going.
+	int num_replacements = 0;
+	for (uint32 code_point : gUtf8CodePoints("a\x80\x80z"))
+		if (code_point == cReplacementCodePoint)
+			num_replacements++;
+	TEST_TRUE(num_replacements == 2);
+};
+
+
+REGISTER_TEST("Utf8Utf16Conversion")
+{
+	// Round-trip 1 to 4-byte sequences, including a surrogate pair in UTF-16.
+	StringView text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+
+	wchar_t utf16[16];
+	int     utf16_size = gUtf8ToUtf16(text, utf16);
+	TEST_TRUE(utf16_size == 5); // 4 code points, the emoji takes 2 UTF-16 units.
+	TEST_TRUE(utf16[0] == L'a');
+	TEST_TRUE(utf16[1] == 0xE9);
+	TEST_TRUE(utf16[2] == 0x20AC);
+	TEST_TRUE(utf16[3] == 0xD83D && utf16[4] == 0xDE00); // U+1F600 as a surrogate pair.
+
+	char utf8[16];
+	int  utf8_size = gUtf16ToUtf8(Span(utf16, utf16_size), utf8);
+	TEST_TRUE(utf8_size == text.Size());
+	TEST_TRUE(StringView(utf8, utf8_size) == text);
+
+	// Errors: invalid input, lone surrogates, output buffer too small.
+	TEST_TRUE(gUtf8ToUtf16("\xED\xA0\x80", utf16) == -1);
+	TEST_TRUE(gUtf8ToUtf16(text, Span(utf16, 4)) == -1); // No room for the full surrogate pair.
+
+	constexpr wchar_t cLoneSurrogate[]     = { 0xD800 };
+	constexpr wchar_t cReversedSurrogate[] = { 0xDC00, 0xD800 };
+	TEST_TRUE(gUtf16ToUtf8(Span(cLoneSurrogate), utf8) == -1);
+	TEST_TRUE(gUtf16ToUtf8(Span(cReversedSurrogate), utf8) == -1);
+	TEST_TRUE(gUtf16ToUtf8(Span(utf16, utf16_size), Span(utf8, 5)) == -1);
+};
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Span.h>
+#include <Bedrock/StringView.h>
+
+// UTF-8 validation, decoding and UTF-16 conversion.
+// Everything rejects (or replaces, for the iterator) overlong encodings, surrogate code points and
+// values above U+10FFFF; validated text can be trusted downstream.
+
+inline constexpr uint32 cInvalidCodePoint     = 0xFFFFFFFF; // Returned by the strict decoders on invalid input.
+inline constexpr uint32 cReplacementCodePoint = 0xFFFD;     // What the code point iterator yields for invalid sequences.
+
+
+// Return true if inString is entirely valid UTF-8.
+// ASCII runs are checked 16 bytes at a time, so mostly-ASCII text goes through very fast.
+bool gIsValidUtf8(StringView inString);
+
+// Convert UTF-8 to UTF-16 (or the reverse). Returns the number of elements written to the output,
+// or -1 if the input is invalid or the output buffer is too small. No null terminator is written.
+int gUtf8ToUtf16(StringView inUtf8, Span<wchar_t> outUtf16);
+int gUtf16ToUtf8(Span<const wchar_t> inUtf16, Span<char> outUtf8);
+
+
+// Decode one code point and advance ioPtr past it.
+// On invalid input, return cInvalidCodePoint and advance ioPtr by a single byte.
+constexpr uint32 gUtf8Decode(const char*& ioPtr, const char* inEnd)
+{
+	gAssert(ioPtr < inEnd);
+
+	const uint8* ptr  = (const uint8*)ioPtr;
+	uint8        byte = ptr[0];
+
+	if (byte < 0x80) [[likely]]
+	{
+		ioPtr++;
+		return byte;
+	}
+
+	int    length, min_code_point;
+	uint32 code_point;
+	if ((byte & 0xE0) == 0xC0)
+	{
+		length         = 2;
+		min_code_point = 0x80;
+		code_point     = byte & 0x1F;
+	}
+	else if ((byte & 0xF0) == 0xE0)
+	{
+		length         = 3;
+		min_code_point = 0x800;
+		code_point     = byte & 0x0F;
+	}
+	else if ((byte & 0xF8) == 0xF0)
+	{
+		length         = 4;
+		min_code_point = 0x10000;
+		code_point     = byte & 0x07;
+	}
+	else
+	{
+		// Continuation byte or invalid lead byte.
+		ioPtr++;
+		return cInvalidCodePoint;
+	}
+
+	if ((inEnd - ioPtr) < length)
+	{
+		ioPtr++;
+		return cInvalidCodePoint; // Truncated sequence.
+	}
+
+	for (int i = 1; i < length; i++)
+	{
+		if ((ptr[i] & 0xC0) != 0x80)
+		{
+			ioPtr++;
+			return cInvalidCodePoint; // Missing continuation byte.
+		}
+		code_point = (code_point << 6) | (ptr[i] & 0x3F);
+	}
+
+	if (code_point < (uint32)min_code_point ||                  // Overlong encoding.
+		(code_point >= 0xD800 && code_point <= 0xDFFF) ||       // Surrogate.
+		code_point > 0x10FFFF)                                  // Above the last code point.
+	{
+		ioPtr++;
+		return cInvalidCodePoint;
+	}
+
+	ioPtr += length;
+	return code_point;
+}
+
+
+// Code point view over a UTF-8 string: for (uint32 code_point : gUtf8CodePoints(string)).
+// Invalid sequences yield cReplacementCodePoint (one per invalid byte) instead of stopping, so it
+// is safe on unvalidated input.
+struct Utf8CodePoints
+{
+	struct Iterator
+	{
+		constexpr uint32 operator*() const
+		{
+			const char* ptr        = mPtr;
+			uint32      code_point = gUtf8Decode(ptr, mEnd);
+			return (code_point == cInvalidCodePoint) ? cReplacementCodePoint : code_point;
+		}
+
+		constexpr Iterator& operator++()
+		{
+			gUtf8Decode(mPtr, mEnd);
+			return *this;
+		}
+
+		constexpr bool operator==(const Iterator& inOther) const { return mPtr == inOther.mPtr; }
+
+		const char* mPtr = nullptr;
+		const char* mEnd = nullptr;
+	};
+
+	constexpr Iterator Begin() const { return { mString.Begin(), mString.End() }; }
+	constexpr Iterator End() const { return { mString.End(), mString.End() }; }
+	constexpr Iterator begin() const { return Begin(); }
+	constexpr Iterator end() const { return End(); }
+
+	StringView mString;
+};
+
+constexpr Utf8CodePoints gUtf8CodePoints(StringView inString) { return { inString }; }
@@ -2,6 +2,7 @@
 #include <Bedrock/Vector.h>
 #include <Bedrock/Test.h>
 #include <Bedrock/String.h>
+#include <Bedrock/StringFormat.h>
 
 
 REGISTER_TEST("Vector")
@@ -370,4 +371,172 @@ REGISTER_TEST("FixedVector")
 	TEST_TRUE(Span(test2) == heap_vec);
 	TEST_TRUE(!test.Empty());
 	TEST_TRUE(test2.Data() != test.Data());
-};
\ No newline at end of file
+};
+
+REGISTER_TEST("InlineVector")
+{
+	InlineVector<int, 4> test;
+
+	// Helper to check if the elements live in the embedded storage (ie. inside the vector object itself).
+	auto is_inline = [](const auto& inVector) {
+		return (const uint8*)inVector.Data() >= (const uint8*)&inVector
+			&& (const uint8*)inVector.Data() <  (const uint8*)(&inVector + 1);
+	};
+
+	// The first 4 elements don't allocate.
+	test = { 1, 2, 3, 4 };
+	TEST_TRUE(is_inline(test));
+	TEST_TRUE(test.Capacity() == 4);
+
+	// The 5th one spills to the heap.
+	test.PushBack(5);
+	TEST_FALSE(is_inline(test));
+	TEST_TRUE(test.Size() == 5);
+	for (int i = 0; i < 5; i++)
+		TEST_TRUE(test[i] == i + 1);
+
+	// Once spilled, moves steal the heap pointer as usual.
+	int* heap_data = test.Data();
+	InlineVector<int, 4> moved = gMove(test);
+	TEST_TRUE(moved.Data() == heap_data);
+	TEST_TRUE(test.Empty());
+
+	// While inline, moves move the elements instead (the storage can't be stolen).
+	InlineVector<int, 4> small = { 1, 2 };
+	InlineVector<int, 4> moved_small = gMove(small);
+	TEST_TRUE(is_inline(moved_small));
+	TEST_TRUE(moved_small.Size() == 2);
+	TEST_TRUE(moved_small[0] == 1 && moved_small[1] == 2);
+	TEST_TRUE(small.Empty());
+
+	// Same with a non-trivial element type.
+	{
+		InlineVector<String, 2> strings;
+		strings.PushBack("a rather long string that heap-allocates");
+		strings.PushBack("another rather long string");
+		TEST_TRUE(is_inline(strings));
+
+		InlineVector<String, 2> moved_strings = gMove(strings);
+		TEST_TRUE(moved_strings[0] == "a rather long string that heap-allocates");
+		TEST_TRUE(strings.Empty());
+
+		// Spill while holding non-trivial elements.
+		moved_strings.PushBack("a third one, for the heap");
+		TEST_FALSE(is_inline(moved_strings));
+		TEST_TRUE(moved_strings[0] == "a rather long string that heap-allocates");
+		TEST_TRUE(moved_strings[2] == "a third one, for the heap");
+	}
+};
+
+REGISTER_TEST("VectorRelocation")
+{
+	// Heap-backed containers relocate with a memcpy, inline-storage ones can't (their data pointer points into themselves).
+	static_assert(cIsTriviallyRelocatable<int>);
+	static_assert(cIsTriviallyRelocatable<Vector<int>>);
+	static_assert(cIsTriviallyRelocatable<Vector<String>>);
+	static_assert(cIsTriviallyRelocatable<String>);
+	static_assert(!cIsTriviallyRelocatable<FixedVector<int, 4>>);
+	static_assert(!cIsTriviallyRelocatable<InlineVector<int, 4>>);
+	static_assert(!cIsTriviallyRelocatable<FixedString<16>>);
+
+	// Exercise the relocation paths with a type that owns heap memory.
+	// Leak detection will catch any double-free/leak from mixing up construct and assign.
+	Vector<String> test;
+	test.Reserve(2);
+
+	// Grow several times.
+	for (int i = 0; i < 20; i++)
+		test.PushBack(gFormat("a rather long string that heap-allocates %d", i));
+
+	for (int i = 0; i < 20; i++)
+		TEST_TRUE(test[i] == gFormat("a rather long string that heap-allocates %d", i));
+
+	// Insert in the middle and at the front (relocates the tail forward).
+	test.Insert(10, String("inserted in the middle"));
+	String front_str("inserted at the front");
+	test.Insert(0, front_str);
+	TEST_TRUE(test[0] == "inserted at the front");
+	TEST_TRUE(test[11] == "inserted in the middle");
+	TEST_TRUE(test[1] == "a rather long string that heap-allocates 0");
+	TEST_TRUE(test.Size() == 22);
+
+	// Emplace in the middle.
+	test.Emplace(5, "emplaced in the middle");
+	TEST_TRUE(test[5] == "emplaced in the middle");
+	TEST_TRUE(test.Size() == 23);
+
+	// Insert a span in the middle.
+	String span_values[] = { String("span value 0"), String("span value 1") };
+	test.Insert(3, Span(span_values, 2));
+	TEST_TRUE(test[3] == "span value 0");
+	TEST_TRUE(test[4] == "span value 1");
+	TEST_TRUE(test[7] == "emplaced in the middle");
+	TEST_TRUE(test.Size() == 25);
+
+	// Erase in the middle (relocates the tail backward).
+	test.Erase(3, 2);
+	test.Erase(5);
+	test.Erase(0);
+	TEST_TRUE(test[0] == "a rather long string that heap-allocates 0");
+	TEST_TRUE(test[9] == "inserted in the middle");
+	TEST_TRUE(test.Size() == 22);
+
+	// Relocating a vector of vectors works too.
+	Vector<Vector<String>> nested;
+	for (int i = 0; i < 10; i++)
+	{
+		Vector<String>& inner = nested.EmplaceBack();
+		inner.PushBack(gFormat("a rather long nested string %d", i));
+	}
+	nested.Erase(2, 3);
+	TEST_TRUE(nested.Size() == 7);
+	TEST_TRUE(nested[2][0] == "a rather long nested string 5");
+};
+
+REGISTER_TEST("VectorAppend")
+{
+	// AppendRange with a trivial type (single memcpy).
+	Vector<int> ints = { 1, 2, 3 };
+	int more_ints[] = { 4, 5, 6, 7 };
+	ints.AppendRange(Span(more_ints));
+	TEST_TRUE(ints.Size() == 7);
+	for (int i = 0; i < 7; i++)
+		TEST_TRUE(ints[i] == i + 1);
+
+	// AppendRange with a non-trivial type (copy-constructs).
+	Vector<String> strings;
+	strings.PushBack("a rather long string that heap-allocates 0");
+	String more_strings[] = { String("a rather long string that heap-allocates 1"), String("a rather long string that heap-allocates 2") };
+	strings.AppendRange(Span(more_strings));
+	TEST_TRUE(strings.Size() == 3);
+	for (int i = 0; i < 3; i++)
+		TEST_TRUE(strings[i] == gFormat("a rather long string that heap-allocates %d", i));
+
+	// PushBackUnchecked on a pre-reserved vector doesn't reallocate.
+	Vector<int> filled;
+	filled.Reserve(100);
+	int* data = filled.Data();
+	for (int i = 0; i < 100; i++)
+		filled.PushBackUnchecked(i);
+	TEST_TRUE(filled.Size() == 100);
+	TEST_TRUE(filled.Data() == data);
+	TEST_TRUE(filled[99] == 99);
+
+	// Move overload.
+	Vector<String> moved_into;
+	moved_into.Reserve(1);
+	String movable("a rather long string that heap-allocates");
+	moved_into.PushBackUnchecked(gMove(movable));
+	TEST_TRUE(movable.Empty());
+	TEST_TRUE(moved_into[0] == "a rather long string that heap-allocates");
+
+	// ResizeUninitialized doesn't touch the elements.
+	Vector<int> uninit;
+	uninit.Resize(10);
+	for (int i = 0; i < 10; i++)
+		uninit[i] = i;
+	uninit.ResizeUninitialized(5);
+	uninit.ResizeUninitialized(10); // Shrinking then growing back doesn't clear anything.
+	for (int i = 0; i < 10; i++)
+		TEST_TRUE(uninit[i] == i);
+};
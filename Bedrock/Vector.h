@@ -64,6 +64,7 @@ struct Vector : private taAllocator
 	bool Empty() const { return mSize == 0; }
 
 	static constexpr bool cHasMaxSize = requires { taAllocator().MaxSize(); };
+	static constexpr bool cHasInlineStorage = requires(const taAllocator& inAllocator) { inAllocator.IsInlineData(nullptr); };
 
 	// Return the max size that this vector can have.
 	// Note: This method only exists for allocators that have an actual max size.
@@ -117,6 +118,16 @@ struct Vector : private taAllocator
 	template <typename... taArgs>
 	taType& EmplaceBack(taArgs&&... inArgs);
 
+	// Append all the elements of inValues at the end (single capacity check, memcpy for trivial types).
+	void AppendRange(Span<const taType> inValues);
+
+	// Like PushBack but without the capacity check. Only for pre-reserved fills, asserts if there's no capacity left.
+	void PushBackUnchecked(const taType& inValue);
+	void PushBackUnchecked(taType&& inValue);
+
+	// Like Resize but leaves new elements uninitialized. Only for trivial types (eg. decode buffers about to be overwritten).
+	void ResizeUninitialized(int inNewSize) requires (cIsTriviallyDefaultConstructible<taType> && cIsTriviallyDestructible<taType>);
+
 	void PopBack();
 
 private:
@@ -142,6 +153,11 @@ using TempVector = Vector<taType, TempAllocator<taType>>;
 template <typename taType>
 using ArenaVector = Vector<taType, ArenaAllocator<taType>>;
 
+// Alias for a Vector using an ArenaAllocator backed by an AtomicMemArena.
+// Useful when many threads fill vectors from the same arena (eg. fan-out/join phases).
+template <typename taType>
+using AtomicArenaVector = Vector<taType, ArenaAllocator<taType, AtomicMemArena>>;
+
 // Alias for a Vector using the VMemAllocator.
 // It allocates virtual memory to grow while keepting the same data address.
 // This is meant for very large Vectors. Virtual memory operations are more expensive than small heap allocations.
@@ -153,6 +169,11 @@ using VMemVector = Vector<taType, VMemAllocator<taType>>;
 template <typename taType, int taSize>
 using FixedVector = Vector<taType, FixedAllocator<taType, taSize>>;
 
+// Alias for a Vector using an InlineAllocator.
+// The first taSize elements are stored inline (no allocation); it spills to the heap beyond that.
+template <typename taType, int taSize>
+using InlineVector = Vector<taType, InlineAllocator<taType, taSize>>;
+
 
 
 // All Vectors are contiguous containers.
@@ -164,6 +185,10 @@ template<class taType> inline constexpr bool cIsStable<VMemVector<taType>> = tru
 // FixedVector is stable, its data address never changes.
 template<class taType, int taSize> inline constexpr bool cIsStable<FixedVector<taType, taSize>> = true;
 
+// Vectors that don't store their elements inline can be relocated with a memcpy (the elements themselves don't move).
+// FixedVector and InlineVector can't, their data pointer points inside the allocator.
+template<class taType, typename taAllocator> inline constexpr bool cIsTriviallyRelocatable<Vector<taType, taAllocator>> = !Vector<taType, taAllocator>::cHasInlineStorage;
+
 
 // Deduction guides for Span.
 template<typename taType, typename taAllocator>
@@ -315,6 +340,16 @@ void Vector<taType, taAllocator>::Reserve(int inCapacity)
 		// This means taType does not need to have a copy constructor.
 		gAssert(old_data == nullptr);
 	}
+	else if constexpr (cIsTriviallyRelocatable<taType>)
+	{
+		// Relocate old data to new with a single copy (no constructors or destructors to run).
+		if (old_data != nullptr)
+		{
+			gMemCopy(mData, old_data, mSize * (int)sizeof(taType));
+
+			Allocator::Free(old_data, old_capacity);
+		}
+	}
 	else
 	{
 		if constexpr (cIsMoveConstructible<taType>)
@@ -335,7 +370,7 @@ void Vector<taType, taAllocator>::Reserve(int inCapacity)
 		{
 			for (int i = 0, n = mSize; i < n; ++i)
 				old_data[i].~taType();
-			
+
 			Allocator::Free(old_data, old_capacity);
 		}
 	}
@@ -364,8 +399,13 @@ void Vector<taType, taAllocator>::Resize(int inNewSize, EResizeInit inInit)
 		// Construct the elements.
 		if (inInit == EResizeInit::ZeroInit)
 		{
-			for (int i = mSize, n = inNewSize; i < n; i++)
-				gPlacementNew(mData[i]);
+			if constexpr (cIsTriviallyDefaultConstructible<taType>)
+				// Zero-initialization of trivial types goes through the bulk kernel: very large
+				// fills use streaming stores instead of evicting the entire cache (see Memory.h).
+				gMemSetNonTemporal(mData + mSize, 0, (int64)(inNewSize - mSize) * sizeof(taType));
+			else
+				for (int i = mSize, n = inNewSize; i < n; i++)
+					gPlacementNew(mData[i]);
 		}
 		else
 		{
@@ -405,7 +445,11 @@ void Vector<taType, taAllocator>::Insert(int inPosition, const taType& inValue)
 		MoveElementsForward(inPosition, inPosition + 1);
 
 		// Copy the new element at inPosition.
-		mData[inPosition] = inValue;
+		// If elements were relocated, inPosition is uninitialized memory and needs a copy-construct instead.
+		if constexpr (cIsTriviallyRelocatable<taType>)
+			gPlacementNew(mData[inPosition], inValue);
+		else
+			mData[inPosition] = inValue;
 	}
 	else
 	{
@@ -433,7 +477,11 @@ void Vector<taType, taAllocator>::Insert(int inPosition, taType&& inValue)
 		MoveElementsForward(inPosition, inPosition + 1);
 
 		// Move the new element at inPosition.
-		mData[inPosition] = gMove(inValue);
+		// If elements were relocated, inPosition is uninitialized memory and needs a move-construct instead.
+		if constexpr (cIsTriviallyRelocatable<taType>)
+			gPlacementNew(mData[inPosition], gMove(inValue));
+		else
+			mData[inPosition] = gMove(inValue);
 	}
 	else
 	{
@@ -462,10 +510,11 @@ void Vector<taType, taAllocator>::Insert(int inPosition, Span<const taType> inVa
 		MoveElementsForward(inPosition, inPosition + inValues.Size());
 
 	// Copy-assign or Copy-construct the new elements depending on if they're past the current end.
+	// If elements were relocated, the freed positions are uninitialized memory and always need a copy-construct.
 	int position = inPosition;
 	for (const taType& value : inValues)
 	{
-		if (position < mSize)
+		if (!cIsTriviallyRelocatable<taType> && position < mSize)
 			mData[position] = value;
 		else
 			gPlacementNew(mData[position], value);
@@ -491,8 +540,9 @@ void Vector<taType, taAllocator>::Emplace(int inPosition, taArgs&&... inArgs)
 		// Move existing elements to free inPosition.
 		MoveElementsForward(inPosition, inPosition + 1);
 
-		// Destruct the element at inPosition.
-		mData[inPosition].~taType();
+		// Destruct the element at inPosition (unless elements were relocated, which leaves it as uninitialized memory already).
+		if constexpr (!cIsTriviallyRelocatable<taType>)
+			mData[inPosition].~taType();
 	}
 
 	// Construct the new element.
@@ -563,6 +613,66 @@ taType& Vector<taType, taAllocator>::EmplaceBack(taArgs&&... inArgs)
 }
 
 
+template <typename taType, typename taAllocator>
+void Vector<taType, taAllocator>::AppendRange(Span<const taType> inValues)
+{
+	if (inValues.Empty())
+		return;
+
+	// Copying from self is not allowed.
+	gAssert(mData > inValues.End() || (mData + mCapacity) < inValues.Begin());
+
+	Grow(mSize + inValues.Size());
+
+	if constexpr (cIsTriviallyCopyable<taType>)
+	{
+		gMemCopy(mData + mSize, inValues.Data(), inValues.Size() * (int)sizeof(taType));
+	}
+	else
+	{
+		taType* data_ptr = mData + mSize;
+		for (const taType& element : inValues)
+		{
+			gPlacementNew(*data_ptr, element);
+			data_ptr++;
+		}
+	}
+
+	mSize += inValues.Size();
+}
+
+
+template <typename taType, typename taAllocator>
+void Vector<taType, taAllocator>::PushBackUnchecked(const taType& inValue)
+{
+	gAssert(mSize < mCapacity); // Not enough capacity, Reserve first.
+
+	gPlacementNew(mData[mSize], inValue);
+	mSize++;
+}
+
+
+template <typename taType, typename taAllocator>
+void Vector<taType, taAllocator>::PushBackUnchecked(taType&& inValue)
+{
+	gAssert(mSize < mCapacity); // Not enough capacity, Reserve first.
+
+	gPlacementNew(mData[mSize], gMove(inValue));
+	mSize++;
+}
+
+
+template <typename taType, typename taAllocator>
+void Vector<taType, taAllocator>::ResizeUninitialized(int inNewSize)
+	requires (cIsTriviallyDefaultConstructible<taType> && cIsTriviallyDestructible<taType>)
+{
+	gAssert(inNewSize >= 0);
+
+	Reserve(inNewSize);
+	mSize = inNewSize;
+}
+
+
 template <typename taType, typename taAllocator>
 void Vector<taType, taAllocator>::PopBack()
 {
@@ -578,6 +688,24 @@ void Vector<taType, taAllocator>::MoveFrom(Vector&& ioOther)
 	// Moving from self is not allowed.
 	gAssert(mData != ioOther.mData || mData == nullptr);
 
+	// If the other vector's elements live in its allocator's embedded storage, the data pointer
+	// can't be stolen; move the elements individually instead.
+	if constexpr (cHasInlineStorage)
+	{
+		if (ioOther.mData != nullptr && ioOther.GetAllocator().IsInlineData(ioOther.mData))
+		{
+			Clear();
+			Reserve(ioOther.mSize);
+			mSize = ioOther.mSize;
+
+			for (int i = 0, n = mSize; i < n; i++)
+				gPlacementNew(mData[i], gMove(ioOther.mData[i]));
+
+			ioOther.ClearAndFreeMemory();
+			return;
+		}
+	}
+
 	// Clear the current data.
 	ClearAndFreeMemory();
 
@@ -657,18 +785,27 @@ void Vector<taType, taAllocator>::MoveElementsForward(int inFromPosition, int in
 	int move_distance  = inToPosition - inFromPosition;
 	gBoundsCheck(inToPosition + num_elem_to_move - 1, mCapacity);
 
-	// First do the move constructs (into unused memory).
-	for (taType* dest = mData + gMax(inToPosition, mSize), *dest_end = mData + inToPosition + num_elem_to_move; dest < dest_end; dest++)
+	if constexpr (cIsTriviallyRelocatable<taType>)
 	{
-		taType* src = dest - move_distance;
-		gPlacementNew(*dest, gMove(*src));
+		// Relocate everything with a single move instead.
+		// Note: This leaves the freed positions as uninitialized memory (callers construct into them instead of assigning).
+		gMemMove(mData + inToPosition, mData + inFromPosition, num_elem_to_move * (int)sizeof(taType));
 	}
-
-	// Then do the move assigns, in reverse order since there may be overlap.
-	for (taType* dest = mData + gMin(inToPosition + num_elem_to_move, mSize) - 1, *dest_end = mData + inToPosition; dest >= dest_end; dest--)
+	else
 	{
-		taType* src = dest - move_distance;
-		*dest = gMove(*src);
+		// First do the move constructs (into unused memory).
+		for (taType* dest = mData + gMax(inToPosition, mSize), *dest_end = mData + inToPosition + num_elem_to_move; dest < dest_end; dest++)
+		{
+			taType* src = dest - move_distance;
+			gPlacementNew(*dest, gMove(*src));
+		}
+
+		// Then do the move assigns, in reverse order since there may be overlap.
+		for (taType* dest = mData + gMin(inToPosition + num_elem_to_move, mSize) - 1, *dest_end = mData + inToPosition; dest >= dest_end; dest--)
+		{
+			taType* src = dest - move_distance;
+			*dest = gMove(*src);
+		}
 	}
 }
 
@@ -691,18 +828,31 @@ void Vector<taType, taAllocator>::MoveElementsBackward(int inFromPosition, int i
 	int move_distance  = inFromPosition - inToPosition;
 	gBoundsCheck(inToPosition, mSize + 1);
 
-	// First do the move assignements.
-	taType* dest = mData + inToPosition;
-	for (taType* dest_end = dest + num_elem_to_move; dest < dest_end; dest++)
+	if constexpr (cIsTriviallyRelocatable<taType>)
 	{
-		taType* src = dest + move_distance;
-		*dest = gMove(*src);
-	}
+		// First destruct the elements that are about to be overwritten.
+		for (taType* elem = mData + inToPosition, *elem_end = mData + inFromPosition; elem < elem_end; elem++)
+			elem->~taType();
 
-	// Then destruct the unused elements.
-	for (taType* dest_end = mData + mSize; dest < dest_end; dest++)
+		// Then relocate everything with a single move.
+		// The vacated positions at the end are uninitialized memory afterwards, nothing to destruct there.
+		gMemMove(mData + inToPosition, mData + inFromPosition, num_elem_to_move * (int)sizeof(taType));
+	}
+	else
 	{
-		dest->~taType();
+		// First do the move assignements.
+		taType* dest = mData + inToPosition;
+		for (taType* dest_end = dest + num_elem_to_move; dest < dest_end; dest++)
+		{
+			taType* src = dest + move_distance;
+			*dest = gMove(*src);
+		}
+
+		// Then destruct the unused elements.
+		for (taType* dest_end = mData + mSize; dest < dest_end; dest++)
+		{
+			dest->~taType();
+		}
 	}
 }
 
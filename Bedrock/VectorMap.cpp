@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MPL-2.0
+#include <Bedrock/VectorMap.h>
+#include <Bedrock/Test.h>
+#include <Bedrock/String.h>
+
+
+REGISTER_TEST("VectorMap")
+{
+	VectorMap<String, String> map;
+	TEST_TRUE(map.Insert("bread", "butter").mResult == EInsertResult::Added);
+	TEST_TRUE(map.Insert("bread", "jam").mResult == EInsertResult::Found);
+	map["toast"] = "rubbish";
+	TEST_TRUE(map.Emplace("bun", "no").mResult == EInsertResult::Added);
+	TEST_TRUE(map.InsertOrAssign("bun", "burger").mResult == EInsertResult::Replaced);
+	TEST_TRUE(map.InsertOrAssign("croissant", "chocolate").mResult == EInsertResult::Added);
+
+	TEST_TRUE(map.Find("bread")->mValue == "butter");
+	TEST_TRUE(map.Find("toast")->mValue == "rubbish");
+	TEST_TRUE(map.Find("bun")->mValue == "burger");
+	TEST_TRUE(map.Find("croissant")->mValue == "chocolate");
+	TEST_TRUE(map.Find("broad") == map.End());
+	TEST_TRUE(map.Size() == 5);
+
+	// Lookups work with any type comparable to the key (no String materialized).
+	StringView buffer = "bread and butter";
+	TEST_TRUE(map.Contains(buffer.SubStr(0, 5)));
+	TEST_TRUE(map.Find(StringView("toast")) != map.End());
+
+	// Iteration is in sorted key order.
+	const VectorMap<String, String>& const_map = map;
+	StringView previous_key;
+	for (const auto& key_value : const_map)
+	{
+		TEST_TRUE(previous_key < key_value.mKey);
+		previous_key = key_value.mKey;
+	}
+
+	TEST_TRUE(map.Erase("toast"));
+	TEST_FALSE(map.Erase("broad"));
+	TEST_TRUE(map.Find("toast") == map.End());
+	TEST_TRUE(map.Size() == 4);
+
+	// Erase by iterator returns the next element (still in sorted order).
+	auto iter = map.Find("bun");
+	iter = map.Erase(iter);
+	TEST_TRUE(iter->mKey == "croissant");
+};
+
+
+REGISTER_TEST("VectorSet")
+{
+	VectorSet<int> set;
+	for (int value : { 5, 3, 8, 1, 9, 3 })
+		set.Insert(value);
+
+	TEST_TRUE(set.Size() == 5); // 3 was only added once.
+	TEST_TRUE(set.Contains(5));
+	TEST_FALSE(set.Contains(4));
+
+	// Iteration is in sorted order.
+	int previous_value = 0;
+	for (int value : set)
+	{
+		TEST_TRUE(previous_value < value);
+		previous_value = value;
+	}
+
+	TEST_TRUE(set.Erase(5));
+	TEST_FALSE(set.Contains(5));
+	TEST_TRUE(set.Size() == 4);
+
+	// FixedVectorMap stores everything in the object itself (no allocation).
+	FixedVectorMap<int, int, 8> fixed_map;
+	for (int i = 7; i >= 0; i--)
+		fixed_map[i] = i * 10;
+	TEST_TRUE(fixed_map.Size() == 8);
+	TEST_TRUE(fixed_map.Begin()->mKey == 0);
+	TEST_TRUE(fixed_map.Find(7)->mValue == 70);
+
+	// TempVectorSet allocates from the temp memory.
+	{
+		TEST_INIT_TEMP_MEMORY(1_KiB);
+
+		TempVectorSet<int> temp_set;
+		temp_set.Insert(2);
+		temp_set.Insert(1);
+		TEST_TRUE(temp_set.Contains(1));
+		TEST_TRUE(temp_set.Size() == 2);
+	}
+
+	// ArenaVectorMap allocates from the arena it's given.
+	FixedMemArena<1_KiB> mem_arena;
+	ArenaVectorMap<int, int> arena_map(mem_arena);
+	arena_map[2] = 20;
+	arena_map[1] = 10;
+	TEST_TRUE(mem_arena.Owns(arena_map.Begin()));
+	TEST_TRUE(arena_map.Begin()->mKey == 1);
+};
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <Bedrock/Core.h>
+#include <Bedrock/Algorithm.h>
+#include <Bedrock/Vector.h>
+#include <Bedrock/HashMap.h> // For KeyValue, MapInsertResult/SetInsertResult and EInsertResult.
+
+
+// Sorted flat map class.
+// The key-values are stored in a single Vector, kept sorted by key (which needs an operator<).
+// Find is a binary search and Insert moves the tail of the vector, so this is meant for small
+// maps (up to a few hundred entries) that are built once and looked up a lot. For those it beats
+// HashMap on both lookup latency and memory (no bucket metadata, no hashing).
+// Iteration sees the keys in sorted order. Behaves as a set if taValue is void (see VectorSet below).
+template <
+	typename taKey,
+	typename taValue,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+struct VectorMap
+{
+	static constexpr bool cIsMap = !cIsVoid<taValue>;
+	static constexpr bool cIsSet =  cIsVoid<taValue>;
+
+	using KeyValue = Conditional<cIsMap, KeyValue<taKey, taValue>, taKey>;
+	using InsertResult = Conditional<cIsMap, MapInsertResult<taKey, taValue>, SetInsertResult<taKey>>;
+
+	using ConstIter = const KeyValue*;
+	using Iter = const KeyValue*; // FIXME Iter should not allow modifying keys
+
+	using KeyValueVector = Vector<KeyValue, taAllocator<KeyValue>>;
+
+	// Default
+	VectorMap() = default;
+	~VectorMap() = default;
+
+	// Default with Allocator (eg. to pass a MemArena when using an ArenaAllocator).
+	explicit VectorMap(typename KeyValueVector::Allocator&& inAllocator) : mKeyValues(gMove(inAllocator)) {}
+
+	// Move
+	VectorMap(VectorMap&&) = default;
+	VectorMap& operator=(VectorMap&&) = default;
+
+	// Copy
+	VectorMap(const VectorMap&) = default;
+	VectorMap& operator=(const VectorMap&) = default;
+
+	void Clear() { mKeyValues.Clear(); }
+	bool Empty() const { return mKeyValues.Empty(); }
+
+	int Size() const { return mKeyValues.Size(); }
+	int Capacity() const { return mKeyValues.Capacity(); }
+
+	void Reserve(int inCapacity) { mKeyValues.Reserve(inCapacity); }
+
+	ConstIter Begin() const { return mKeyValues.Begin(); }
+	ConstIter End() const { return mKeyValues.End(); }
+	Iter Begin() { return mKeyValues.Begin(); }
+	Iter End() { return mKeyValues.End(); }
+	ConstIter begin() const { return mKeyValues.Begin(); }
+	ConstIter end() const { return mKeyValues.End(); }
+	Iter begin() { return mKeyValues.Begin(); }
+	Iter end() { return mKeyValues.End(); }
+
+	// Find --------------------------------------------------
+	// Note: Any key type with an operator< against taKey works (eg. StringView for String keys).
+
+	template <typename taAltKey>
+	Iter Find(const taAltKey& inKey) requires cIsMap
+	{
+		return FindInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	ConstIter Find(const taAltKey& inKey) const
+	{
+		return FindInternal(inKey);
+	}
+
+	template <typename taAltKey>
+	bool Contains(const taAltKey& inKey) const
+	{
+		return Find(inKey) != End();
+	}
+
+	// Insert (Map version) -----------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(const taKey& inKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult Insert(taKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Insert (Set version) -----------------------------------
+
+	InsertResult Insert(const taKey& inKey) requires cIsSet
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey);
+	}
+
+	InsertResult Insert(taKey&& ioKey) requires cIsSet
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey));
+	}
+
+	// InsertOrAssign (Map only) ------------------------------
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(const taKey& inKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(inKey, gForward<taAltValue>(ioValue));
+	}
+
+	template <typename taAltValue>
+	requires cIsAssignable<taValue&, taAltValue&&>
+	InsertResult InsertOrAssign(taKey&& ioKey, taAltValue&& ioValue) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::Yes>(gMove(ioKey), gForward<taAltValue>(ioValue));
+	}
+
+	// Emplace (Map and Set) ---------------------------------
+
+	template <typename... taArgs>
+	InsertResult Emplace(const taKey& inKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey, gForward<taArgs>(ioArgs)...);
+	}
+
+	template <typename... taArgs>
+	InsertResult Emplace(taKey&& ioKey, taArgs&&... ioArgs)
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey), gForward<taArgs>(ioArgs)...);
+	}
+
+	// Operator[] (Map only) ---------------------------------
+
+	template<class T = taValue>
+	T& operator[](const taKey& inKey) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(inKey).mValue;
+	}
+
+	template<class T = taValue>
+	T& operator[](taKey&& ioKey) requires cIsMap
+	{
+		return EmplaceInternal<EReplaceExisting::No>(gMove(ioKey)).mValue;
+	}
+
+	// Erase (Map and Set) -----------------------------------
+
+	template <typename taAltKey>
+	bool Erase(const taAltKey& inKey)
+	{
+		int index = LowerBoundIndex(inKey);
+
+		if (index == mKeyValues.Size() || !(GetKey(mKeyValues[index]) == inKey))
+			return false; // Key does not exist.
+
+		mKeyValues.Erase(index); // Note: keeps the vector sorted, unlike SwapErase.
+		return true;
+	}
+
+	Iter Erase(Iter inIter)
+	{
+		int index = (int)(inIter - Begin());
+		mKeyValues.Erase(index);
+		return Begin() + index;
+	}
+
+protected:
+	// Helper to get the key (because of the KeyValue difference between Map/Set).
+	static const taKey& GetKey(const KeyValue& inKeyValue)
+	{
+		if constexpr (cIsMap)
+			return inKeyValue.mKey;
+		else
+			return inKeyValue;
+	}
+
+	// Internal function to find a key.
+	template <typename taAltKey>
+	Iter FindInternal(const taAltKey& inKey) const
+	{
+		int index = LowerBoundIndex(inKey);
+
+		if (index < mKeyValues.Size() && GetKey(mKeyValues[index]) == inKey)
+			return mKeyValues.Begin() + index;
+
+		return End();
+	}
+
+	// Return the index of the first key-value whose key is not less than inKey.
+	template <typename taAltKey>
+	int LowerBoundIndex(const taAltKey& inKey) const
+	{
+		ConstIter it = gLowerBound(mKeyValues.Begin(), mKeyValues.End(), inKey,
+			[](const KeyValue& inKeyValue, const taAltKey& inSearchedKey) { return GetKey(inKeyValue) < inSearchedKey; });
+
+		return (int)(it - mKeyValues.Begin());
+	}
+
+	enum class EReplaceExisting
+	{
+		No,
+		Yes,
+	};
+
+	// Internal function to emplace a key and value.
+	template <EReplaceExisting taReplaceExisting, typename taAltKey, typename... taArgs>
+	InsertResult EmplaceInternal(taAltKey&& ioKey, taArgs&&... ioArgs)
+	{
+		int index = LowerBoundIndex(ioKey);
+
+		if (index < mKeyValues.Size() && GetKey(mKeyValues[index]) == ioKey)
+		{
+			// Key already exists.
+			KeyValue& key_value = mKeyValues[index];
+
+			if constexpr (taReplaceExisting == EReplaceExisting::No || !cIsMap)
+			{
+				// Return the existing value.
+				return { key_value, EInsertResult::Found };
+			}
+			else
+			{
+				// Replace the existing value.
+				key_value.mValue = { gForward<taArgs>(ioArgs)... };
+				return { key_value, EInsertResult::Replaced };
+			}
+		}
+
+		// Key does not exist, insert it at the right position to keep the vector sorted.
+		mKeyValues.Emplace(index, gForward<taAltKey>(ioKey), gForward<taArgs>(ioArgs)...);
+
+		return { mKeyValues[index], EInsertResult::Added };
+	}
+
+	KeyValueVector mKeyValues; // Key-value pairs, sorted by key.
+};
+
+
+namespace Details
+{
+	// Helper to turn FixedAllocator into a single-param template (to pass a size through VectorMap's allocator param).
+	template <int taSize>
+	struct VectorMapFixedAllocator
+	{
+		template <typename taType> using Alloc = FixedAllocator<taType, taSize>;
+	};
+}
+
+
+// VectorSet variant of the VectorMap (no values).
+template <
+	typename taKey,
+	template <typename> typename taAllocator = DefaultAllocator
+>
+using VectorSet = VectorMap<taKey, void, taAllocator>;
+
+
+// Alias for a VectorMap using the TempAllocator.
+template <typename taKey, typename taValue>
+using TempVectorMap = VectorMap<taKey, taValue, TempAllocator>;
+
+// Alias for a VectorSet using the TempAllocator.
+template <typename taKey>
+using TempVectorSet = VectorSet<taKey, TempAllocator>;
+
+
+// Alias for a VectorMap using a FixedAllocator.
+// It contains a fixed size buffer large enough to store taSize key-values.
+template <typename taKey, typename taValue, int taSize>
+using FixedVectorMap = VectorMap<taKey, taValue, Details::VectorMapFixedAllocator<taSize>::template Alloc>;
+
+// Alias for a VectorSet using a FixedAllocator.
+template <typename taKey, int taSize>
+using FixedVectorSet = VectorSet<taKey, Details::VectorMapFixedAllocator<taSize>::template Alloc>;
+
+
+// Alias for a VectorMap using the ArenaAllocator.
+// A MemArena needs to be passed to the VectorMap before it can be used.
+template <typename taKey, typename taValue>
+using ArenaVectorMap = VectorMap<taKey, taValue, ArenaAllocator>;
+
+// Alias for a VectorSet using the ArenaAllocator.
+template <typename taKey>
+using ArenaVectorSet = VectorSet<taKey, ArenaAllocator>;
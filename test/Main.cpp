@@ -1,5 +1,7 @@
 #include <Bedrock/Core.h>
 #include <Bedrock/Test.h>
+#include <Bedrock/Benchmark.h>
+#include <Bedrock/StringView.h>
 
 int main(int argc, char* argv[])
 {
@@ -7,8 +9,22 @@ int main(int argc, char* argv[])
 	gThreadInitTempMemory(gMemAlloc(1_MiB));
 	defer { gMemFree(gThreadExitTempMemory()); };
 
+	// Run the benchmarks instead of the tests if requested.
+	bool parallel = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (StringView(argv[i]) == "--benchmarks")
+		{
+			gRunBenchmarks();
+			return 0;
+		}
+
+		if (StringView(argv[i]) == "--parallel")
+			parallel = true;
+	}
+
 	// Run the tests.
-	TestResult result = gRunTests();
+	TestResult result = parallel ? gRunTestsParallel() : gRunTests();
 
 	return (result == TestResult::Success) ? 0 : 1;
 }